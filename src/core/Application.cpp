@@ -2,13 +2,22 @@
 #include "core/AudioSystem.h"
 #include "core/Engine.h"
 #include "core/ImGuiLayer.h"
+#include "core/ResourceManager.h"
 #include "core/Window.h"
+#include "core/memory/AllocatorBenchmark.h"
+#include "core/memory/FrameAllocator.h"
+#include "core/memory/MemoryTracker.h"
+#include "core/threading/JobBenchmark.h"
+#include "core/threading/JobSystem.h"
 
 #include "ecs/Component.h"
 #include "ecs/Entity.h"
+#include "ecs/Prefab.h"
+#include "ecs/SystemScheduler.h"
 
 #include "editor/Editor.h"
 
+#include "game/CombatSystem.h"
 #include "game/CommandRegistry.h"
 #include "game/DevConsole.h"
 #include "game/FPSController.h"
@@ -17,8 +26,10 @@
 #include "game/PhysicsSystem.h"
 #include "game/Projectile.h"
 #include "game/ProjectileSystem.h"
+#include "game/RenderSnapshot.h"
 #include "game/RenderSystem.h"
 #include "game/ScriptSystem.h"
+#include "game/TransformSystem.h"
 #include "game/Weapon.h"
 
 #include "input/Input.h"
@@ -32,8 +43,11 @@
 
 #include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
+#include <algorithm>
+#include <cstdio>
 #include <iostream>
 #include <string>
+#include <thread>
 
 namespace Archura {
 
@@ -75,6 +89,7 @@ bool Application::Init() {
 
     AudioSystem::Get().Init();
     NetworkManager::Get().Init();
+    JobSystem::Init();
     DevConsole::Get().Init();
 
     // Register Commands
@@ -165,6 +180,161 @@ bool Application::Init() {
             Application::Get().Quit();
         });
 
+    // Pipeline modu: sonraki frame'in simulasyonu worker'da, bu frame'in cizimi ana thread'de
+    CommandRegistry::Get().RegisterCommand(
+        "r_pipeline", [](const std::vector<std::string>& args) {
+            if (!args.empty()) {
+                try {
+                    Application::Get().SetPipelinedFrames(std::stoi(args[0]) != 0);
+                } catch (...) {
+                    DevConsole::Get().Log("Usage: r_pipeline [0|1]");
+                    return;
+                }
+            }
+            DevConsole::Get().Log(std::string("Pipelined frames: ") +
+                (Application::Get().IsPipelinedFrames() ? "ON" : "OFF") +
+                (JobSystem::GetWorkerCount() == 0 ? " (no workers, running serial)" : ""));
+        });
+
+    // Son frame'in heap ayirmalari ve frame arenasi kullanimi (kararli durumda heap ~0 olmali)
+    CommandRegistry::Get().RegisterCommand(
+        "mem_frame", [](const std::vector<std::string>&) {
+            FrameAllocatorStats stats;
+            FrameAllocator::GetStats(stats);
+
+            char line[256];
+            snprintf(line, sizeof(line), "Frame %llu: %llu heap allocations (%llu KB)",
+                (unsigned long long)stats.frameIndex, (unsigned long long)stats.heapAllocations,
+                (unsigned long long)(stats.heapBytes / 1024));
+            DevConsole::Get().Log(line);
+
+            snprintf(line, sizeof(line), "Frame arena: %zu KB used (peak %zu KB), %zu KB committed of %zu MB reserved, %u threads, %u overflows",
+                stats.usedBytes / 1024, stats.peakBytes / 1024, stats.committedBytes / 1024,
+                stats.reservedBytes / (1024 * 1024), stats.threadCount, stats.overflowAllocations);
+            DevConsole::Get().Log(line);
+        });
+
+    // Thread'ler arasi ayirma stres testi: ConcurrentPoolAllocator vs global heap, 1..cekirdek sayisi thread
+    CommandRegistry::Get().RegisterCommand(
+        "mem_pool_bench", [](const std::vector<std::string>& args) {
+            uint32_t opsPerThread = 1000000;
+            size_t objectSize = 64;
+            try {
+                if (args.size() > 0) opsPerThread = static_cast<uint32_t>(std::stoul(args[0]));
+                if (args.size() > 1) objectSize = static_cast<size_t>(std::stoul(args[1]));
+            } catch (...) {
+                DevConsole::Get().Log("Usage: mem_pool_bench [opsPerThread] [objectSize]");
+                return;
+            }
+
+            uint32_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+            double poolBase = 0.0;
+            char line[256];
+            for (uint32_t threads = 1;; threads = std::min(threads * 2, maxThreads)) {
+                AllocatorBenchmarkResult result = RunConcurrentPoolBenchmark(threads, opsPerThread, objectSize);
+                if (threads == 1) poolBase = result.poolMopsPerSec;
+
+                snprintf(line, sizeof(line), "%2u threads: pool %7.1f Mops/s (%.1fx), heap %7.1f Mops/s",
+                    threads, result.poolMopsPerSec, poolBase > 0.0 ? result.poolMopsPerSec / poolBase : 0.0,
+                    result.heapMopsPerSec);
+                DevConsole::Get().Log(line);
+
+                if (threads == maxThreads) break;
+            }
+        });
+
+    // JobSystem is yeniden kurularak 1..(cekirdek-1) worker ile bos job throughput'u ve job basina heap ayirmasi
+    CommandRegistry::Get().RegisterCommand(
+        "job_bench", [](const std::vector<std::string>& args) {
+            uint32_t jobCount = 1000000;
+            try {
+                if (args.size() > 0) jobCount = static_cast<uint32_t>(std::stoul(args[0]));
+            } catch (...) {
+                DevConsole::Get().Log("Usage: job_bench [jobCount]");
+                return;
+            }
+
+            uint32_t maxWorkers = std::max(2u, std::thread::hardware_concurrency()) - 1;
+            double base = 0.0;
+            char line[256];
+            for (uint32_t workers = 1;; workers = std::min(workers * 2, maxWorkers)) {
+                JobSystem::Shutdown();
+                JobSystem::Init(workers);
+                JobBenchmarkResult result = RunJobSystemBenchmark(jobCount);
+                JobBenchmarkResult large = RunJobSystemBenchmark(jobCount, true);
+                if (workers == 1) base = result.mjobsPerSec;
+
+                snprintf(line, sizeof(line), "%2u workers%s: %u jobs in %.1f ms, %6.2f Mjobs/s (%.1fx), %.2f allocs/job",
+                    workers, JobSystem::IsMainThreadParticipating() ? " + main" : "", jobCount,
+                    result.seconds * 1000.0, result.mjobsPerSec, base > 0.0 ? result.mjobsPerSec / base : 0.0,
+                    result.allocationsPerJob);
+                DevConsole::Get().Log(line);
+
+                // Kayda sigmayan capture'lar (heap yolu): eski std::function job'larina yakin maliyet
+                snprintf(line, sizeof(line), "            large captures: %6.2f Mjobs/s, %.2f allocs/job",
+                    large.mjobsPerSec, large.allocationsPerJob);
+                DevConsole::Get().Log(line);
+
+                if (workers == maxWorkers) break;
+            }
+
+            // Varsayilan worker sayisina don
+            JobSystem::Shutdown();
+            JobSystem::Init();
+        });
+
+    // Wait() sirasinda ana thread job calistirsin mi
+    CommandRegistry::Get().RegisterCommand(
+        "job_main_thread", [](const std::vector<std::string>& args) {
+            if (!args.empty()) {
+                JobSystem::SetMainThreadParticipation(args[0] != "0");
+            }
+            DevConsole::Get().Log(JobSystem::IsMainThreadParticipating()
+                ? "Main thread participates in JobSystem::Wait"
+                : "Main thread only waits in JobSystem::Wait");
+        });
+
+#if ARCH_MEMORY_TRACKING
+    // Alt sistem butceleri: asildiginda MemoryTracker bir kez uyarir
+    MemoryTracker::SetBudget(MemoryTag::Rendering, 128ull * 1024 * 1024);
+    MemoryTracker::SetBudget(MemoryTag::ECS, 64ull * 1024 * 1024);
+    MemoryTracker::SetBudget(MemoryTag::Physics, 16ull * 1024 * 1024);
+    MemoryTracker::SetBudget(MemoryTag::Audio, 64ull * 1024 * 1024);
+    MemoryTracker::SetBudget(MemoryTag::Network, 1ull * 1024 * 1024);
+    MemoryTracker::SetBudget(MemoryTag::Assets, 256ull * 1024 * 1024);
+
+    // Etiket basina canli/tepe bellek ve butce
+    CommandRegistry::Get().RegisterCommand(
+        "mem_tags", [](const std::vector<std::string>&) {
+            char line[256];
+            for (size_t i = 0; i < static_cast<size_t>(MemoryTag::Count); ++i) {
+                MemoryTag tag = static_cast<MemoryTag>(i);
+                MemoryTagStats stats;
+                MemoryTracker::GetStats(tag, stats);
+
+                snprintf(line, sizeof(line), "%-9s %8zu KB live (%zu allocs), peak %8zu KB, budget %zu KB%s",
+                    MemoryTracker::GetTagName(tag), stats.liveBytes / 1024, stats.liveAllocations,
+                    stats.peakBytes / 1024, stats.budgetBytes / 1024,
+                    (stats.budgetBytes != 0 && stats.liveBytes > stats.budgetBytes) ? "  OVER BUDGET" : "");
+                DevConsole::Get().Log(line);
+            }
+        });
+
+    CommandRegistry::Get().RegisterCommand(
+        "mem_budget", [](const std::vector<std::string>& args) {
+            MemoryTag tag;
+            if (args.size() < 2 || !MemoryTracker::ParseTag(args[0].c_str(), tag)) {
+                DevConsole::Get().Log("Usage: mem_budget <Rendering|ECS|Physics|Audio|Network|Assets|General> <MB> (0 = none)");
+                return;
+            }
+            try {
+                MemoryTracker::SetBudget(tag, static_cast<size_t>(std::stoull(args[1])) * 1024 * 1024);
+            } catch (...) {
+                DevConsole::Get().Log("Invalid budget");
+            }
+        });
+#endif
+
     m_ImGuiLayer = std::make_unique<ImGuiLayer>();
     m_ImGuiLayer->Init(m_Window);
 
@@ -218,6 +388,103 @@ void Application::Run() {
     ProjectileSystem projectileSystem;
     projectileSystem.Init(&scene);
 
+    // Kayit sirasi = cakisan sistemlerin calisma sirasi
+    SystemScheduler systemScheduler;
+    systemScheduler.AddSystem(&projectileSystem);
+    systemScheduler.AddSystem(&physicsSystem);
+    systemScheduler.AddSystem(&scriptSystem);
+    systemScheduler.AddSystem(&particleSystem);
+
+    // Olay tuketicisi: scheduler bittikten sonra ana thread'de calisir
+    CombatSystem combatSystem;
+    combatSystem.Init(&scene);
+
+    // Matris onbellegi her frame (duraklatilmisken de, editor icin) yenilenir
+    TransformSystem transformSystem;
+    transformSystem.Init(&scene);
+
+    // Simulasyon durumunu N frame geri sarar (component degerleri; yapisal degisiklikler kalir)
+    CommandRegistry::Get().RegisterCommand(
+        "rewind", [&scene](const std::vector<std::string>& args) {
+            try {
+                uint32_t frames = args.empty() ? 1 : static_cast<uint32_t>(std::stoul(args[0]));
+                SnapshotRing& snapshots = scene.GetSnapshots();
+                uint32_t latest = snapshots.GetLatestFrame();
+                if (frames >= latest || !scene.Restore(latest - frames)) {
+                    DevConsole::Get().Log("rewind: frame not in history (max " +
+                        std::to_string(snapshots.GetCapacity() - 1) + ")");
+                    return;
+                }
+                DevConsole::Get().Log("Rewound " + std::to_string(frames) + " frames (history " +
+                    std::to_string(snapshots.GetUsedBytes() / 1024) + " KB)");
+            } catch (...) {
+                DevConsole::Get().Log("Usage: rewind <frames>");
+            }
+        });
+
+    // Isimle entity arama (Scene isim indeksi)
+    CommandRegistry::Get().RegisterCommand(
+        "find", [&scene](const std::vector<std::string>& args) {
+            if (args.empty()) {
+                DevConsole::Get().Log("Usage: find <entity name>");
+                return;
+            }
+
+            const std::vector<Entity*>& found = scene.FindEntitiesByName(args[0]);
+            DevConsole::Get().Log(std::to_string(found.size()) + " entities named '" + args[0] + "'");
+            for (size_t i = 0; i < found.size() && i < 16; ++i) {
+                const glm::vec3& position = found[i]->GetComponent<Transform>()->position;
+                char line[128];
+                snprintf(line, sizeof(line), "  #%u at (%.1f, %.1f, %.1f)", GetEntityIndex(found[i]->GetID()),
+                    position.x, position.y, position.z);
+                DevConsole::Get().Log(line);
+            }
+        });
+
+    // ECS bellek/doluluk ozeti; "ecs_stats archetypes" archetype listesini de yazar
+    CommandRegistry::Get().RegisterCommand(
+        "ecs_stats", [&scene](const std::vector<std::string>& args) {
+            SceneStats stats;
+            scene.GetStats(stats);
+
+            char line[256];
+            snprintf(line, sizeof(line), "Entities %u, archetypes %u (%u empty), chunks %zu/%zu KB (%.0f%% unused, %zu KB pooled), snapshots %zu KB",
+                stats.entityCount, stats.archetypeCount, stats.emptyArchetypeCount,
+                stats.usedChunkBytes / 1024, stats.chunkBytes / 1024, stats.GetFragmentation() * 100.0f,
+                stats.idleChunkBytes / 1024, stats.snapshotBytes / 1024);
+            DevConsole::Get().Log(line);
+
+            const SceneFrameCounters& frame = stats.lastFrame;
+            snprintf(line, sizeof(line), "Last frame: +%u/-%u entities, %u moves, chunks +%u/-%u",
+                frame.entitiesCreated, frame.entitiesDestroyed, frame.archetypeMoves,
+                frame.chunkAllocations, frame.chunkReleases);
+            DevConsole::Get().Log(line);
+
+            for (const ComponentTypeStats& type : stats.components) {
+                if (!type.info) continue;
+                snprintf(line, sizeof(line), "  %-16s %6u  %8.1f KB used  %8.1f KB reserved  +%u/-%u",
+                    type.info->name, type.count, type.bytes / 1024.0f, type.reservedBytes / 1024.0f,
+                    type.added, type.removed);
+                DevConsole::Get().Log(line);
+            }
+
+            snprintf(line, sizeof(line), "Names: %zu interned (%zu KB)",
+                StringID::GetInternedCount(), StringID::GetInternedBytes() / 1024);
+            DevConsole::Get().Log(line);
+
+            if (!args.empty() && args[0] == "archetypes") {
+                for (const ArchetypeStats& archetype : stats.archetypes) {
+                    std::string name;
+                    for (const ComponentInfo* info : archetype.archetype->GetSignature()) {
+                        name += name.empty() ? info->name : std::string(" | ") + info->name;
+                    }
+                    snprintf(line, sizeof(line), "  %6u ent %3zu chunks  %s",
+                        archetype.entities, archetype.chunks, name.c_str());
+                    DevConsole::Get().Log(line);
+                }
+            }
+        });
+
     // --- SETUP ROBUST MAP (V2) ---
     // 1. Sun
     Entity* light = scene.CreateEntity("Sun");
@@ -235,11 +502,14 @@ void Application::Run() {
     ambientComp->color = glm::vec3(0.6f, 0.6f, 0.7f); // Hafif mavimsi golge 
     ambientComp->intensity = 0.5f;
 
+    // Zemin ve duvarlar tek kup mesh'i paylasir (sahibi ResourceManager)
+    Mesh* cubeMesh = ResourceManager::Get().AddMesh("cube", Mesh::CreateCube());
+
     // 2. Floor
     Entity* floor = scene.CreateEntity("Floor");
     {
         auto* mesh = floor->AddComponent<MeshRenderer>();
-        mesh->mesh = Mesh::CreateCube();
+        mesh->mesh = cubeMesh;
         mesh->color = glm::vec3(0.4f, 0.4f, 0.45f);
 
         auto* trans = floor->GetComponent<Transform>();
@@ -267,18 +537,29 @@ void Application::Run() {
         { "Wall_West",  {-offset, wallY, 0}, {wallThick, wallHeight, mapSize}, {0.8f, 0.8f, 0.4f} }
     };
 
-    for(const auto& w : walls) {
-        Entity* wall = scene.CreateEntity(w.name);
-        auto* mesh = wall->AddComponent<MeshRenderer>();
-        mesh->mesh = Mesh::CreateCube();
-        mesh->color = w.c;
-        wall->GetComponent<Transform>()->position = w.p;
-        wall->GetComponent<Transform>()->scale = w.s;
-        
-        auto* col = wall->AddComponent<BoxCollider>();
+    // Duvarlar tek prefab'tan toplu olusturulur (tek kup mesh paylasilir)
+    Prefab wallPrefab("Wall");
+    wallPrefab.AddComponent<MeshRenderer>()->mesh = cubeMesh;
+    {
+        auto* col = wallPrefab.AddComponent<BoxCollider>();
         col->size = glm::vec3(1.0f, 1.0f, 1.0f);
         col->isTrigger = false;
     }
+
+    std::vector<Transform> wallTransforms(walls.size());
+    for (size_t i = 0; i < walls.size(); ++i) {
+        wallTransforms[i].position = walls[i].p;
+        wallTransforms[i].scale = walls[i].s;
+    }
+
+    std::vector<EntityID> wallIDs(walls.size());
+    scene.Instantiate(wallPrefab, static_cast<uint32_t>(walls.size()), wallTransforms.data(), wallIDs.data());
+
+    for (size_t i = 0; i < walls.size(); ++i) {
+        Entity* wall = scene.GetEntity(wallIDs[i]);
+        wall->SetName(walls[i].name);
+        wall->GetComponent<MeshRenderer>()->color = walls[i].c;
+    }
     // ---------------------------
 
     PauseMenu pauseMenu;
@@ -289,6 +570,11 @@ void Application::Run() {
 
     input->SetCursorMode(GLFW_CURSOR_DISABLED);
 
+    // Cift tampon: biri cizilirken digerini simulasyon doldurur
+    RenderSnapshot renderSnapshots[2];
+    uint32_t frontSnapshot = 0;
+    JobCounter simulationCounter;
+
     while (!window->ShouldClose() && m_Running) {
         float time = (float)glfwGetTime();
         float deltaTime = time - (float)m_LastFrameTime;
@@ -317,23 +603,65 @@ void Application::Run() {
         }
 
         // 2. Game Logic
-        if (!m_IsPaused) {
-            // FPSController Update
+        // Simulasyon + frame sonu islemleri, en sonda cizim verisi arka snapshot'a alinir
+        bool paused = m_IsPaused;
+        float aspectRatio = window->GetAspectRatio();
+        RenderSnapshot& backSnapshot = renderSnapshots[frontSnapshot ^ 1];
+
+        // FPSController ana thread'de: Input glfwGetKey/glfwGetMouseButton cagirir (GLFW
+        // sadece ana thread'e izin verir). Simulasyon job'i henuz baslamadigi icin sahneye yazmasi guvenli
+        if (!paused) {
             m_FPSController->Update(input, &scene, deltaTime, &projectileSystem);
-            
-            projectileSystem.Update(deltaTime);
-            physicsSystem.Update(deltaTime);
-            scriptSystem.Update(deltaTime);
-            particleSystem.Update(deltaTime);
-            AudioSystem::Get().Update(&scene, &camera);
+        }
+
+        auto simulate = [&]() {
+            if (!paused) {
+                // Cakismayan sistemler JobSystem worker'larinda paralel calisir
+                systemScheduler.Update(deltaTime);
+
+                // Olay tuketim noktasi: isabet/patlama -> hasar, isabet efektleri
+                combatSystem.Update(deltaTime);
+                projectileSystem.ProcessHitEvents();
+
+                // Sistemlerin kaydettigi yapisal degisiklikleri uygula
+                scene.FlushCommands();
+            }
+
+            transformSystem.Update(deltaTime);
+
+            // Geri sarma/tekrar gecmisi: degismeyen veri onceki frame'le paylasilir
+            if (!paused) {
+                scene.Snapshot();
+            }
+
+            // ECS profiler sayaclari: bu frame'in yapisal degisiklikleri kapatilir
+            scene.EndStatsFrame();
+
+            // Frame'in olaylari: tuketilmeyenler silinir
+            scene.GetEvents().EndFrame();
+
+            renderSystem.Capture(backSnapshot, aspectRatio);
+        };
+
+        // Pipeline: bu frame'in simulasyonu worker'da, ana thread onceki frame'in snapshot'ini
+        // cizer (gecikme en fazla bir frame). Job input'a ve GL'e dokunmaz. Editor, konsol ve
+        // duraklatma menusu cizim sirasinda sahneye ana thread'den dokunur; onlar acikken sirali calisilir
+        bool pipelined = m_PipelinedFrames && JobSystem::GetWorkerCount() > 0 && !paused &&
+                         !m_DevModeActive && !DevConsole::Get().IsOpen() && renderSnapshots[frontSnapshot].valid;
+
+        if (pipelined) {
+            JobSystem::Execute([&simulate]() { simulate(); }, &simulationCounter);
+        } else {
+            simulate();
+            frontSnapshot ^= 1;
         }
 
         // 3. Rendering
         renderer->BeginFrame(); // Clear Screen
         m_ImGuiLayer->BeginFrame(); // Starts ImGui Frame
 
-        // Render 3D Scene
-        renderSystem.Update(deltaTime);
+        // Render 3D Scene (sadece snapshot okunur)
+        renderSystem.Render(renderSnapshots[frontSnapshot]);
         
         // Render UI (ImGui)
         if (m_DevModeActive) {
@@ -350,10 +678,29 @@ void Application::Run() {
 
         m_ImGuiLayer->EndFrame(); // Render ImGui Draw Data
         renderer->EndFrame(); // Finalize Frame
+
+        // Simulasyon bitmeden sonraki frame'e gecilmez; yeni snapshot one alinir
+        if (pipelined) {
+            JobSystem::Wait(simulationCounter);
+            frontSnapshot ^= 1;
+        }
+
+        // MCI cagrilari ana thread'de kalir
+        if (!paused) {
+            AudioSystem::Get().Update(&scene, &camera);
+        }
+
+        // Frame arenasi: bu frame'in ayirmalari bir sonraki frame sonuna kadar gecerli
+        FrameAllocator::EndFrame();
         
         // Update Input State for next frame (PreviousKeys = CurrentKeys)
         input->EndFrame();
     }
+
+    JobSystem::Shutdown();
+
+    // GL context hala gecerliyken paylasilan mesh/texture/shader'lar silinir
+    ResourceManager::Get().Clear();
 }
 
 } // namespace Archura
@@ -35,6 +35,7 @@ namespace Archura {
         std::unique_ptr<class FPSController> m_FPSController;
         bool m_DevModeActive = true;
         bool m_IsPaused = false;
+        bool m_PipelinedFrames = true; // r_pipeline: simulasyon N+1 ile cizim N ust uste
 
     public:
         // Console Command Helpers
@@ -42,6 +43,8 @@ namespace Archura {
         void SetSensitivity(float sens);
         void SetDevMode(bool enabled);
         bool IsDevMode() const { return m_DevModeActive; }
+        void SetPipelinedFrames(bool enabled) { m_PipelinedFrames = enabled; }
+        bool IsPipelinedFrames() const { return m_PipelinedFrames; }
         
         class FPSController* GetFPSController() { return m_FPSController.get(); }
     };
@@ -5,6 +5,7 @@
 #define NOMINMAX
 #include <windows.h>
 #include <mmsystem.h> // Added mmsystem.h
+#include <cstring>
 #include <iostream>
 #include <filesystem>
 #include <vector> // Added vector
@@ -36,6 +37,7 @@ void AudioSystem::Shutdown() {
     StopMusic();
     // Tum sesleri kapat
     mciSendString("close all", NULL, 0, NULL);
+    m_Voices.Clear();
 }
 
 void AudioSystem::PlayMusic(const std::string& filename, bool loop) {
@@ -80,31 +82,44 @@ void AudioSystem::PlayOneShot(const std::string& filename) {
         return;
     }
 
-    // Benzersiz alias (SFX_0, SFX_1, ...)
-    std::string alias = "SFX_" + std::to_string(m_NextSoundID++);
-    
+    // MCI'da "auto close" yok: biten sesler burada kapatilir, kanal sayisi sinirli
+    ReclaimFinishedVoices();
+    if (m_Voices.GetActiveCount() >= MAX_SFX_VOICES) {
+        return; // Tum kanallar dolu, efekt atlanir
+    }
+
+    auto handle = m_Voices.Acquire();
+    SfxVoice* voice = m_Voices.Get(handle);
+    voice->alias = "SFX_" + std::to_string(handle.index);
+
     // Dosyayi ac
-    std::string cmdOpen = "open \"" + path + "\" type mpegvideo alias " + alias;
-    mciSendString(cmdOpen.c_str(), NULL, 0, NULL);
-
-    // Cal ve bitince otomatik kapat (notify kullanilabilir ama basitlik icin wait yapmiyoruz)
-    // MCI'da "auto close" yok, bu yuzden surekli yeni alias acmak bellek sizintisina yol acabilir.
-    // Ancak basit kullanim icin "play" komutu yeterli.
-    // Daha iyi bir yontem: "play alias from 0 notify" ve callback ile kapatmak.
-    // Simdilik basit "fire and forget" yapiyoruz, ama alias'lari temizlemedigimiz icin uzun surede sorun olabilir.
-    // Cozum: Sadece belirli sayida kanal kullanmak veya kisa sesler icin WAV kullanmak.
-    // MP3 icin MCI biraz agir.
-    
-    // Pratik cozum: Cal ve kapat komutunu ayni anda veremeyiz.
-    // Bu yuzden sadece "play" diyoruz. 
-    
+    std::string cmdOpen = "open \"" + path + "\" type mpegvideo alias " + voice->alias;
+    if (mciSendString(cmdOpen.c_str(), NULL, 0, NULL) != 0) {
+        m_Voices.Release(handle);
+        return;
+    }
+
     // Ses seviyesini ayarla
-    ApplyVolume(alias, m_SFXVolume);
+    ApplyVolume(voice->alias, m_SFXVolume);
 
-    std::string cmdPlay = "play " + alias;
+    std::string cmdPlay = "play " + voice->alias;
     mciSendString(cmdPlay.c_str(), NULL, 0, NULL);
 }
 
+void AudioSystem::ReclaimFinishedVoices() {
+    char mode[32];
+    m_Voices.ForEach([&](ObjectPool<SfxVoice>::Handle handle, SfxVoice& voice) {
+        std::string cmdStatus = "status " + voice.alias + " mode";
+        if (mciSendString(cmdStatus.c_str(), mode, sizeof(mode), NULL) == 0 && strcmp(mode, "playing") == 0) {
+            return;
+        }
+
+        std::string cmdClose = "close " + voice.alias;
+        mciSendString(cmdClose.c_str(), NULL, 0, NULL);
+        m_Voices.Release(handle);
+    });
+}
+
 void AudioSystem::StopMusic() {
     if (!m_CurrentMusicAlias.empty()) {
         std::string cmd = "close " + m_CurrentMusicAlias;
@@ -145,29 +160,28 @@ void AudioSystem::ApplyVolume(const std::string& alias, float channelVolume) {
 void AudioSystem::Update(Scene* scene, Camera* camera) {
     if (!scene || !camera) return;
 
-    for (auto& entityPtr : scene->GetEntities()) {
-        auto* source = entityPtr->GetComponent<AudioSource>();
-        if (!source || !source->isPlaying) continue;
+    glm::vec3 listenerPos = camera->GetPosition();
 
-        auto* transform = entityPtr->GetComponent<Transform>();
-        if (!transform) continue;
+    // 1. Mesafe zayiflamasi: sadece matematik, chunk'lar paralel hesaplanir
+    scene->View<AudioSource, Transform>().ParallelEach([listenerPos](AudioSource& source, Transform& transform) {
+        if (!source.isPlaying) return;
 
         // Calculate distance
-        float distance = glm::distance(transform->position, camera->GetPosition());
+        float distance = glm::distance(transform.position, listenerPos);
 
         // Linear attenuation
         // minDistance: volume = max
         // maxDistance: volume = 0
         
-        float volume = source->volume;
+        float volume = source.volume;
         
-        if (distance < source->minDistance) {
-            volume = source->volume;
-        } else if (distance > source->maxDistance) {
+        if (distance < source.minDistance) {
+            volume = source.volume;
+        } else if (distance > source.maxDistance) {
             volume = 0.0f;
         } else {
-            float pct = 1.0f - ((distance - source->minDistance) / (source->maxDistance - source->minDistance));
-            volume = source->volume * pct;
+            float pct = 1.0f - ((distance - source.minDistance) / (source.maxDistance - source.minDistance));
+            volume = source.volume * pct;
         }
         
         // MCI uses volume 0-1000
@@ -175,15 +189,23 @@ void AudioSystem::Update(Scene* scene, Camera* camera) {
         if (finalVol < 0) finalVol = 0;
         if (finalVol > 1000) finalVol = 1000;
 
-        std::string alias = source->runtimeAlias;
+        source.targetVolume = finalVol;
+    });
+
+    // 2. MCI komutlari bu thread'den, sadece ses seviyesi degisen kaynaklar icin
+    scene->View<AudioSource>().Each([](Entity* entity, AudioSource& source) {
+        if (!source.isPlaying || source.targetVolume == source.appliedVolume) return;
+
+        std::string alias = source.runtimeAlias;
         if (alias.empty()) {
-            alias = std::string("sound_") + std::to_string(entityPtr->GetID());
-            source->runtimeAlias = alias;
+            alias = std::string("sound_") + std::to_string(entity->GetID());
+            source.runtimeAlias = alias;
         }
 
-        std::string cmd = "setaudio " + alias + " volume to " + std::to_string(finalVol);
+        std::string cmd = "setaudio " + alias + " volume to " + std::to_string(source.targetVolume);
         mciSendStringA(cmd.c_str(), NULL, 0, NULL);
-    }
+        source.appliedVolume = source.targetVolume;
+    });
 }
 
 void AudioSystem::Play(AudioSource* source, const std::string& alias) {
@@ -205,6 +227,7 @@ void AudioSystem::Play(AudioSource* source, const std::string& alias) {
         if (source->loop) cmdPlay += " repeat";
         mciSendString(cmdPlay.c_str(), NULL, 0, NULL);
         source->isPlaying = true;
+        source->appliedVolume = -1; // Yeni acilan ses: seviye bir sonraki Update'te gonderilir
     } else {
          std::cerr << "AudioSource Open Error: " << path << std::endl;
     }
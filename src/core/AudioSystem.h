@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ObjectPool.h"
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -65,8 +66,18 @@ private:
 
     void ApplyVolume(const std::string& alias, float volume);
 
+    // Calmasi biten efekt seslerini kapatir ve havuza geri verir
+    void ReclaimFinishedVoices();
+
+    // Ayni anda acik en fazla efekt sesi; alias'lar slot indeksiyle tekrar kullanilir (SFX_<slot>)
+    static constexpr uint32_t MAX_SFX_VOICES = 32;
+
+    struct SfxVoice {
+        std::string alias;
+    };
+
     std::string m_CurrentMusicAlias;
-    int m_NextSoundID = 0;
+    ObjectPool<SfxVoice> m_Voices{ MAX_SFX_VOICES, MAX_SFX_VOICES, MemoryTag::Audio };
 
     float m_MasterVolume = 1.0f;
     float m_MusicVolume = 1.0f;
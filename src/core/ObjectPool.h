@@ -1,81 +1,235 @@
 #pragma once
 
+#include "memory/MemoryTracker.h"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <vector>
-#include <functional>
-#include <memory>
 
 namespace Archura {
 
 /**
- * @brief Object Pool - Sık oluşturulan/silinen nesneleri yönet
- * 
- * Bellek fragmentation ve allocation overhead'ini azaltır.
- * Reusable objects (Projectiles, Particles, vb.) için ideal.
+ * @brief PoolHandle - ObjectPool nesnesine generation'li referans
+ *
+ * Nesne Release edildikten sonra (slot yeniden kullanilsa bile) eski handle
+ * gecersiz olur; Get() nullptr dondurur.
+ */
+template<typename T>
+struct PoolHandle {
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    uint32_t index = INVALID_INDEX;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return index != INVALID_INDEX; }
+    bool operator==(const PoolHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const PoolHandle& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Object Pool - Sik olusturulan/silinen nesneleri yonet
+ *
+ * Nesneler chunk'larda ardisik saklanir (chunk'lar tasinmaz, adresler sabit).
+ * Bos slotlar indeks tabanli intrusive bir free list'tir; Acquire/Release
+ * ayirma yapmaz (sadece kapasite dolunca yeni chunk eklenir). Canli nesneler
+ * ayrica yogun (dense) bir indeks dizisinde tutulur, ForEach bosluk atlamadan
+ * sadece canlilari gezer.
+ *
+ * Slot generation'i tek ise slot canlidir; her Acquire/Release bir artirir.
+ * Thread-safe degildir.
  */
 template<typename T>
 class ObjectPool {
 public:
-    explicit ObjectPool(size_t initialCapacity = 100)
-        : m_Capacity(initialCapacity) {
-        m_Available.reserve(initialCapacity);
-        for (size_t i = 0; i < initialCapacity; ++i) {
-            m_Available.push_back(std::make_unique<T>());
+    using Handle = PoolHandle<T>;
+
+    explicit ObjectPool(size_t initialCapacity = 100, uint32_t chunkSize = 256, MemoryTag tag = MemoryTag::General)
+        : m_Tag(tag)
+    {
+        // Chunk boyutu 2'nin kuvveti: indeks -> (chunk, offset) kaydirma/maske ile
+        m_ChunkShift = 0;
+        while ((1u << m_ChunkShift) < chunkSize && m_ChunkShift < 31) {
+            ++m_ChunkShift;
+        }
+        m_ChunkMask = (1u << m_ChunkShift) - 1;
+        Reserve(initialCapacity);
+    }
+
+    ~ObjectPool() {
+        Clear();
+        for (std::byte* chunk : m_Chunks) {
+            ::operator delete(chunk, std::align_val_t(alignof(T)));
         }
     }
 
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
     /**
-     * @brief Pool'dan bir nesne al
+     * @brief Pool'dan bir nesne al (args ile yerinde olusturulur)
      */
-    T* Acquire() {
-        if (m_Available.empty()) {
-            // Capacity'yi 2 katına çıkart
-            m_Capacity *= 2;
-            for (size_t i = 0; i < m_Capacity / 2; ++i) {
-                m_Available.push_back(std::make_unique<T>());
-            }
+    template<typename... Args>
+    Handle Acquire(Args&&... args) {
+        if (m_FreeHead == Handle::INVALID_INDEX) {
+            AddChunk();
         }
 
-        auto obj = std::move(m_Available.back());
-        m_Available.pop_back();
-        
-        T* ptr = obj.get();
-        m_Active[ptr] = std::move(obj);
-        return ptr;
+        uint32_t index = m_FreeHead;
+        Slot& slot = m_Slots[index];
+
+        // Once olustur: constructor hata atarsa pool degismemis olur
+        new (GetObjectAt(index)) T(std::forward<Args>(args)...);
+
+        m_FreeHead = slot.link;
+        ++slot.generation;
+        slot.link = static_cast<uint32_t>(m_Dense.size());
+        m_Dense.push_back(index);  // AddChunk kapasite kadar reserve eder, ayirma yapmaz
+        return Handle{ index, slot.generation };
     }
 
     /**
-     * @brief Nesneyi pool'a geri koy
+     * @brief Nesneyi yok et ve pool'a geri koy (eski handle gecersiz olur)
      */
-    void Release(T* obj) {
-        auto it = m_Active.find(obj);
-        if (it != m_Active.end()) {
-            m_Available.push_back(std::move(it->second));
-            m_Active.erase(it);
-        }
+    bool Release(Handle handle) {
+        T* object = Get(handle);
+        if (!object) return false;
+        object->~T();
+
+        // Dense diziden swap-remove
+        Slot& slot = m_Slots[handle.index];
+        uint32_t denseIndex = slot.link;
+        uint32_t lastIndex = m_Dense.back();
+        m_Dense[denseIndex] = lastIndex;
+        m_Slots[lastIndex].link = denseIndex;
+        m_Dense.pop_back();
+
+        ++slot.generation;
+        slot.link = m_FreeHead;
+        m_FreeHead = handle.index;
+        return true;
+    }
+
+    // Handle gecersizse (bos, eski generation) nullptr
+    T* Get(Handle handle) {
+        return IsAlive(handle) ? GetObjectAt(handle.index) : nullptr;
+    }
+
+    const T* Get(Handle handle) const {
+        return IsAlive(handle) ? GetObjectAt(handle.index) : nullptr;
+    }
+
+    bool IsAlive(Handle handle) const {
+        return handle.index < m_Slots.size()
+            && (handle.generation & 1u) != 0
+            && m_Slots[handle.index].generation == handle.generation;
     }
 
     /**
-     * @brief Aktif nesne sayısını getir
+     * @brief Canli nesneleri gez: func(T&) veya func(Handle, T&)
+     *
+     * Sondan basa gezilir; func sadece o anki nesneyi Release edebilir (baska
+     * nesneleri degil). Gezinti sirasinda Acquire edilenler gorulmez.
      */
-    size_t GetActiveCount() const { return m_Active.size(); }
+    template<typename Func>
+    void ForEach(Func&& func) {
+        for (size_t i = m_Dense.size(); i-- > 0;) {
+            uint32_t index = m_Dense[i];
+            if constexpr (std::is_invocable_v<Func&, Handle, T&>) {
+                func(Handle{ index, m_Slots[index].generation }, *GetObjectAt(index));
+            } else {
+                func(*GetObjectAt(index));
+            }
+        }
+    }
 
     /**
-     * @brief Kullanılabilir nesne sayısını getir
+     * @brief Kapasiteyi en az count nesneye cikar
      */
-    size_t GetAvailableCount() const { return m_Available.size(); }
+    void Reserve(size_t count) {
+        while (GetCapacity() < count) {
+            AddChunk();
+        }
+    }
 
     /**
-     * @brief Tüm nesneleri temizle
+     * @brief Tum canli nesneleri yok et (chunk'lar korunur, tum handle'lar gecersiz olur)
      */
     void Clear() {
-        m_Active.clear();
-        m_Available.clear();
+        for (uint32_t index : m_Dense) {
+            GetObjectAt(index)->~T();
+            ++m_Slots[index].generation;
+        }
+        m_Dense.clear();
+
+        // Free list yeniden kurulur: dusuk indeksler once verilir
+        m_FreeHead = Handle::INVALID_INDEX;
+        for (size_t i = m_Slots.size(); i-- > 0;) {
+            m_Slots[i].link = m_FreeHead;
+            m_FreeHead = static_cast<uint32_t>(i);
+        }
     }
 
+    /**
+     * @brief Aktif nesne sayisini getir
+     */
+    size_t GetActiveCount() const { return m_Dense.size(); }
+
+    /**
+     * @brief Kullanilabilir nesne sayisini getir
+     */
+    size_t GetAvailableCount() const { return GetCapacity() - m_Dense.size(); }
+
+    size_t GetCapacity() const { return m_Slots.size(); }
+
 private:
-    std::vector<std::unique_ptr<T>> m_Available;  // Kullanılabilir nesneler
-    std::unordered_map<T*, std::unique_ptr<T>> m_Active;  // Aktif nesneler
-    size_t m_Capacity;
+    struct Slot {
+        uint32_t generation = 0;             // Tek: canli, cift: bos
+        uint32_t link = Handle::INVALID_INDEX;  // Bos: sonraki bos slot, canli: m_Dense'teki yeri
+    };
+
+    T* GetObjectAt(uint32_t index) const {
+        return reinterpret_cast<T*>(m_Chunks[index >> m_ChunkShift] + (index & m_ChunkMask) * sizeof(T));
+    }
+
+    void AddChunk() {
+        size_t chunkSize = size_t(1) << m_ChunkShift;
+        size_t first = m_Slots.size();
+        assert(first + chunkSize < Handle::INVALID_INDEX && "ObjectPool kapasitesi asildi");
+
+        // Tum buyumeler ayirmadan once: sonradan hata atilirsa chunk sizmaz
+        size_t capacity = first + chunkSize;
+        if (m_Slots.capacity() < capacity) {
+            m_Slots.reserve(std::max(capacity, m_Slots.capacity() * 2));
+        }
+        if (m_Dense.capacity() < capacity) {
+            m_Dense.reserve(std::max(capacity, m_Dense.capacity() * 2));
+        }
+        m_Chunks.reserve(m_Chunks.size() + 1);
+
+        size_t bytes = sizeof(T) * chunkSize;
+        void* chunk = ::operator new(bytes, std::align_val_t(alignof(T)));
+        ARCH_TRACK_ALLOC(chunk, bytes, m_Tag);
+        m_Chunks.push_back(static_cast<std::byte*>(chunk));
+
+        // Yeni slotlar free list'in basina, adres sirasiyla verilecek sekilde
+        m_Slots.resize(capacity);
+        for (size_t i = capacity; i-- > first;) {
+            m_Slots[i].link = m_FreeHead;
+            m_FreeHead = static_cast<uint32_t>(i);
+        }
+    }
+
+    std::vector<std::byte*> m_Chunks;
+    std::vector<Slot> m_Slots;
+    std::vector<uint32_t> m_Dense;       // Canli slot indeksleri (ardisik)
+    uint32_t m_FreeHead = Handle::INVALID_INDEX;
+    uint32_t m_ChunkShift = 0;
+    uint32_t m_ChunkMask = 0;
+    MemoryTag m_Tag;
 };
 
 } // namespace Archura
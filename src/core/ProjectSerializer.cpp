@@ -29,7 +29,7 @@ namespace Archura {
 
         auto& entities = scene->GetEntities();
         for (size_t i = 0; i < entities.size(); ++i) {
-            file << SerializeEntity(entities[i].get());
+            file << SerializeEntity(entities[i]);
             if (i < entities.size() - 1) {
                 file << ",";
             }
@@ -2,6 +2,7 @@
 #include "../rendering/Shader.h"
 #include "../rendering/Texture.h"
 #include "../rendering/Mesh.h"
+#include "memory/MemoryTracker.h"
 #include <iostream>
 
 namespace Archura {
@@ -22,7 +23,7 @@ Shader* ResourceManager::LoadShader(const std::string& name, const std::string&
     }
 
     // Yeni shader yukle
-    Shader* shader = new Shader();
+    Shader* shader = ARCH_NEW(MemoryTag::Assets) Shader();
     if (shader->LoadFromFile(vertPath, fragPath)) {
         m_Shaders[name] = shader;
         // std::cout << "Loaded shader: " << name << std::endl;
@@ -47,7 +48,7 @@ Texture* ResourceManager::LoadTexture(const std::string& name, const std::string
         return it->second;
     }
 
-    Texture* texture = new Texture();
+    Texture* texture = ARCH_NEW(MemoryTag::Assets) Texture();
     if (texture->LoadFromFile(path, generateMipmaps)) {
         m_Textures[name] = texture;
         return texture;
@@ -1,8 +1,10 @@
 #pragma once
 
+#include "memory/MemoryResource.h"
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <memory_resource>
 
 namespace Archura {
 
@@ -50,9 +52,12 @@ private:
     ResourceManager& operator=(const ResourceManager&) = delete;
 
 private:
-    std::unordered_map<std::string, Shader*> m_Shaders;
-    std::unordered_map<std::string, Texture*> m_Textures;
-    std::unordered_map<std::string, Mesh*> m_Meshes;
+    // Map node'lari ve bucket dizileri havuzdan (ana thread); map'lerden once tanimli olmali
+    UnsynchronizedPoolResource m_MapMemory;
+
+    std::pmr::unordered_map<std::string, Shader*> m_Shaders{ &m_MapMemory };
+    std::pmr::unordered_map<std::string, Texture*> m_Textures{ &m_MapMemory };
+    std::pmr::unordered_map<std::string, Mesh*> m_Meshes{ &m_MapMemory };
 };
 
 } // namespace Archura
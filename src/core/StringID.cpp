@@ -0,0 +1,83 @@
+#include "StringID.h"
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace Archura {
+
+// Kayitlar deque'da: eklemede adresler degismez, StringID'ler ve anahtar view'lari gecerli kalir
+struct StringID::Table {
+    struct ViewHash {
+        size_t operator()(std::string_view text) const { return static_cast<size_t>(StringID::Hash(text)); }
+    };
+
+    std::mutex mutex;
+    std::deque<Entry> entries;
+    std::unordered_map<std::string_view, const Entry*, ViewHash> lookup;
+    size_t bytes = 0;
+    const Entry* empty = nullptr;
+
+    Table() {
+        entries.push_back(Entry{ StringID::Hash({}), std::string() });
+        empty = &entries.back();
+        lookup.emplace(std::string_view(empty->text), empty);
+    }
+};
+
+StringID::Table& StringID::GetTable() {
+    static Table table;
+    return table;
+}
+
+uint64_t StringID::Hash(std::string_view text) {
+    // FNV-1a 64 bit
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : text) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+StringID::StringID()
+    : m_Entry(GetTable().empty)
+{
+}
+
+StringID::StringID(std::string_view text) {
+    Table& table = GetTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    auto it = table.lookup.find(text);
+    if (it != table.lookup.end()) {
+        m_Entry = it->second;
+        return;
+    }
+
+    table.entries.push_back(Entry{ Hash(text), std::string(text) });
+    m_Entry = &table.entries.back();
+    table.lookup.emplace(std::string_view(m_Entry->text), m_Entry);
+    table.bytes += sizeof(Entry) + m_Entry->text.capacity() + 1;
+}
+
+StringID StringID::Find(std::string_view text) {
+    Table& table = GetTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    auto it = table.lookup.find(text);
+    return StringID(it != table.lookup.end() ? it->second : table.empty);
+}
+
+size_t StringID::GetInternedCount() {
+    Table& table = GetTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return table.entries.size();
+}
+
+size_t StringID::GetInternedBytes() {
+    Table& table = GetTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return table.bytes + table.lookup.size() * (sizeof(std::string_view) + sizeof(void*) * 2);
+}
+
+} // namespace Archura
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace Archura {
+
+/**
+ * @brief StringID - Motor genelinde intern edilmis (interned) string
+ *
+ * Her farkli string global tabloda bir kez saklanir; StringID sadece o kayda
+ * isaretci tutar. Kopyalama ve karsilastirma isaretci islemidir, GetString()
+ * ayirma yapmaz. Ayni metinden olusan tum StringID'ler esittir.
+ *
+ * Kayitlar program sonuna kadar yasar (tablo kuculmez); bu yuzden dinamik,
+ * sinirsiz metinler (kullanici girdisi vb.) yerine isimler/etiketler icin
+ * kullanilmalidir. Olusturma thread-safe'tir (tablo kilitlenir).
+ */
+class StringID {
+public:
+    // Bos string
+    StringID();
+    StringID(std::string_view text);
+    StringID(const char* text) : StringID(std::string_view(text)) {}
+    StringID(const std::string& text) : StringID(std::string_view(text)) {}
+
+    // Metin daha once intern edilmemisse bos StringID dondurur (tabloya eklemez)
+    static StringID Find(std::string_view text);
+
+    const std::string& GetString() const { return m_Entry->text; }
+    const char* c_str() const { return m_Entry->text.c_str(); }
+    uint64_t GetHash() const { return m_Entry->hash; }
+    bool IsEmpty() const { return m_Entry->text.empty(); }
+
+    bool operator==(const StringID& other) const { return m_Entry == other.m_Entry; }
+    bool operator!=(const StringID& other) const { return m_Entry != other.m_Entry; }
+
+    // Intern edilmis farkli string sayisi ve tahmini bellek kullanimi
+    static size_t GetInternedCount();
+    static size_t GetInternedBytes();
+
+private:
+    struct Entry {
+        uint64_t hash;
+        std::string text;
+    };
+
+    struct Table;
+
+    explicit StringID(const Entry* entry) : m_Entry(entry) {}
+
+    static Table& GetTable();
+    static uint64_t Hash(std::string_view text);
+
+    const Entry* m_Entry;
+};
+
+} // namespace Archura
+
+namespace std {
+
+template<>
+struct hash<Archura::StringID> {
+    size_t operator()(const Archura::StringID& id) const noexcept {
+        return static_cast<size_t>(id.GetHash());
+    }
+};
+
+} // namespace std
@@ -0,0 +1,135 @@
+#include "AllocatorBenchmark.h"
+#include "ConcurrentPoolAllocator.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace Archura {
+
+namespace {
+
+constexpr uint32_t HANDOFF_CAPACITY = 1024;  // Power of two
+constexpr uint32_t LOCAL_WINDOW = 32;        // Locally freed objects live this many iterations
+
+// Single producer (owning thread) / single consumer (next thread)
+struct alignas(64) HandoffRing {
+    void* slots[HANDOFF_CAPACITY];
+    alignas(64) std::atomic<uint32_t> head{0};
+    alignas(64) std::atomic<uint32_t> tail{0};
+
+    bool TryPush(void* ptr) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= HANDOFF_CAPACITY) return false;
+        slots[h & (HANDOFF_CAPACITY - 1)] = ptr;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    void* TryPop() {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return nullptr;
+        void* ptr = slots[t & (HANDOFF_CAPACITY - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return ptr;
+    }
+};
+
+template<typename AllocateFunc, typename FreeFunc>
+double RunWorkload(uint32_t threadCount, uint32_t opsPerThread, size_t objectSize,
+                   AllocateFunc&& allocate, FreeFunc&& free) {
+    std::unique_ptr<HandoffRing[]> rings(new HandoffRing[threadCount]);
+    std::atomic<uint32_t> ready{0};
+    std::atomic<bool> start{false};
+
+    auto worker = [&](uint32_t index) {
+        HandoffRing& outgoing = rings[index];
+        HandoffRing& incoming = rings[(index + threadCount - 1) % threadCount];
+        bool remote = threadCount > 1;
+
+        void* window[LOCAL_WINDOW] = {};
+
+        ready.fetch_add(1, std::memory_order_acq_rel);
+        while (!start.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+
+        for (uint32_t op = 0; op < opsPerThread; ++op) {
+            void* ptr = allocate();
+            static_cast<uint32_t*>(ptr)[0] = op;
+            static_cast<char*>(ptr)[objectSize - 1] = static_cast<char>(op);
+
+            if (remote && (op & 1)) {
+                if (!outgoing.TryPush(ptr)) {
+                    free(ptr);
+                }
+            } else {
+                void*& slot = window[op % LOCAL_WINDOW];
+                if (slot) free(slot);
+                slot = ptr;
+            }
+
+            while (void* received = incoming.TryPop()) {
+                free(received);
+            }
+        }
+
+        for (void* ptr : window) {
+            if (ptr) free(ptr);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+    for (uint32_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back(worker, i);
+    }
+    while (ready.load(std::memory_order_acquire) < threadCount) {
+        std::this_thread::yield();
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    // Objects still in flight when their consumer finished
+    for (uint32_t i = 0; i < threadCount; ++i) {
+        while (void* ptr = rings[i].TryPop()) {
+            free(ptr);
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(end - begin).count();
+    double operations = static_cast<double>(threadCount) * opsPerThread;
+    return seconds > 0.0 ? operations / seconds / 1e6 : 0.0;
+}
+
+} // namespace
+
+AllocatorBenchmarkResult RunConcurrentPoolBenchmark(uint32_t threadCount, uint32_t opsPerThread, size_t objectSize) {
+    if (threadCount == 0) threadCount = 1;
+    if (objectSize < sizeof(uint32_t)) objectSize = sizeof(uint32_t);
+
+    AllocatorBenchmarkResult result;
+    result.threadCount = threadCount;
+    result.operations = static_cast<uint64_t>(threadCount) * opsPerThread;
+
+    {
+        ConcurrentPoolAllocator pool(objectSize, alignof(std::max_align_t));
+        result.poolMopsPerSec = RunWorkload(threadCount, opsPerThread, objectSize,
+            [&]() { return pool.Allocate(objectSize, alignof(std::max_align_t)); },
+            [&](void* ptr) { pool.Free(ptr); });
+    }
+
+    result.heapMopsPerSec = RunWorkload(threadCount, opsPerThread, objectSize,
+        [&]() { return ::operator new(objectSize); },
+        [&](void* ptr) { ::operator delete(ptr); });
+
+    return result;
+}
+
+} // namespace Archura
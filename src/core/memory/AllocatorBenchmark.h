@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Archura {
+
+struct AllocatorBenchmarkResult {
+    uint32_t threadCount = 0;
+    uint64_t operations = 0;      // Allocate + Free pairs, all threads
+    double poolMopsPerSec = 0.0;  // ConcurrentPoolAllocator
+    double heapMopsPerSec = 0.0;  // Global operator new/delete
+};
+
+/**
+ * @brief Stress test for cross-thread allocation
+ *
+ * Each thread allocates and touches opsPerThread objects. Half of them are
+ * freed locally after a short delay; the other half go through a ring to the
+ * next thread, which frees them (remote free). The same workload runs once
+ * against a ConcurrentPoolAllocator and once against the global heap.
+ *
+ * Spawns its own threads; meant for a console command, not the frame loop.
+ */
+AllocatorBenchmarkResult RunConcurrentPoolBenchmark(uint32_t threadCount, uint32_t opsPerThread, size_t objectSize = 64);
+
+} // namespace Archura
@@ -0,0 +1,274 @@
+#include "ConcurrentPoolAllocator.h"
+#include "PoolAllocator.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace Archura {
+
+namespace {
+
+constexpr uint64_t EMPTY_STACK = 0xFFFFFFFFull;
+constexpr uint32_t NO_THREAD_SLOT = 0xFFFFFFFFu;
+constexpr unsigned char FREED_PATTERN = 0xDD;
+
+// Thread slots are shared by all ConcurrentPoolAllocators and recycled on
+// thread exit (the dead thread's caches are handed to the next owner)
+struct ThreadSlotRegistry {
+    std::mutex mutex;
+    std::vector<uint32_t> freeSlots;
+    uint32_t nextSlot = 0;
+};
+
+ThreadSlotRegistry& GetSlotRegistry() {
+    static ThreadSlotRegistry registry;
+    return registry;
+}
+
+struct ThreadSlot {
+    uint32_t value = NO_THREAD_SLOT;
+
+    ThreadSlot() {
+        ThreadSlotRegistry& registry = GetSlotRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        if (!registry.freeSlots.empty()) {
+            value = registry.freeSlots.back();
+            registry.freeSlots.pop_back();
+        } else if (registry.nextSlot < ConcurrentPoolAllocator::MAX_THREADS) {
+            value = registry.nextSlot++;
+        }
+    }
+
+    ~ThreadSlot() {
+        if (value == NO_THREAD_SLOT) return;
+        ThreadSlotRegistry& registry = GetSlotRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.freeSlots.push_back(value);
+    }
+};
+
+uint32_t GetThreadSlot() {
+    thread_local ThreadSlot slot;
+    return slot.value;
+}
+
+} // namespace
+
+ConcurrentPoolAllocator::ConcurrentPoolAllocator(size_t objectSize, size_t objectAlignment, MemoryTag tag)
+    : m_ObjectSize(PoolAllocator::GetSlotSize(objectSize, objectAlignment))
+    , m_ObjectAlignment(std::max(objectAlignment, alignof(void*)))
+    , m_Tag(tag)
+    , m_FullMagazines(EMPTY_STACK)
+    , m_EmptyMagazines(EMPTY_STACK)
+{
+    assert(objectAlignment != 0 && (objectAlignment & (objectAlignment - 1)) == 0 && "Pool alignment must be a power of two");
+    m_SlabBytes = m_ObjectSize * MAGAZINE_SIZE * MAGAZINES_PER_SLAB;
+}
+
+ConcurrentPoolAllocator::~ConcurrentPoolAllocator() {
+    for (char* slab : m_Slabs) {
+        ::operator delete(slab, std::align_val_t(m_ObjectAlignment));
+    }
+    for (auto& chunk : m_MagazineChunks) {
+        delete[] chunk.load(std::memory_order_relaxed);
+    }
+}
+
+void* ConcurrentPoolAllocator::Allocate(size_t size, size_t alignment) {
+    assert(size <= m_ObjectSize && "Allocation larger than pool object size");
+    assert(alignment <= m_ObjectAlignment && "Allocation alignment larger than pool alignment");
+    (void)size;
+    (void)alignment;
+
+    uint32_t slot = GetThreadSlot();
+    if (slot != NO_THREAD_SLOT) {
+        return AllocateFrom(m_Caches[slot]);
+    }
+
+    std::lock_guard<std::mutex> lock(m_SharedMutex);
+    return AllocateFrom(m_SharedCache);
+}
+
+void ConcurrentPoolAllocator::Free(void* ptr) {
+    if (!ptr) return;
+
+#if ARCH_POOL_DEBUG
+    std::memset(ptr, FREED_PATTERN, m_ObjectSize);
+#endif
+
+    uint32_t slot = GetThreadSlot();
+    if (slot != NO_THREAD_SLOT) {
+        FreeTo(m_Caches[slot], ptr);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_SharedMutex);
+    FreeTo(m_SharedCache, ptr);
+}
+
+void* ConcurrentPoolAllocator::AllocateFrom(ThreadCache& cache) {
+    if (cache.loaded != INVALID_MAGAZINE) {
+        Magazine& loaded = GetMagazine(cache.loaded);
+        if (loaded.count > 0) {
+            return loaded.objects[--loaded.count];
+        }
+    }
+
+    // Second magazine still has objects: swap instead of going to the depot
+    if (cache.previous != INVALID_MAGAZINE && GetMagazine(cache.previous).count > 0) {
+        std::swap(cache.loaded, cache.previous);
+        Magazine& loaded = GetMagazine(cache.loaded);
+        return loaded.objects[--loaded.count];
+    }
+
+    if (cache.loaded != INVALID_MAGAZINE) {
+        Push(m_EmptyMagazines, cache.loaded);
+    }
+    cache.loaded = TakeFullMagazine();
+
+    Magazine& loaded = GetMagazine(cache.loaded);
+    return loaded.objects[--loaded.count];
+}
+
+void ConcurrentPoolAllocator::FreeTo(ThreadCache& cache, void* ptr) {
+    if (cache.loaded != INVALID_MAGAZINE) {
+        Magazine& loaded = GetMagazine(cache.loaded);
+        if (loaded.count < MAGAZINE_SIZE) {
+            loaded.objects[loaded.count++] = ptr;
+            return;
+        }
+    }
+
+    if (cache.previous != INVALID_MAGAZINE && GetMagazine(cache.previous).count < MAGAZINE_SIZE) {
+        std::swap(cache.loaded, cache.previous);
+        Magazine& loaded = GetMagazine(cache.loaded);
+        loaded.objects[loaded.count++] = ptr;
+        return;
+    }
+
+    // Both magazines full: the older one goes to the depot
+    if (cache.loaded != INVALID_MAGAZINE) {
+        if (cache.previous != INVALID_MAGAZINE) {
+            Push(m_FullMagazines, cache.previous);
+        }
+        cache.previous = cache.loaded;
+    }
+    cache.loaded = TakeEmptyMagazine();
+
+    Magazine& loaded = GetMagazine(cache.loaded);
+    loaded.objects[loaded.count++] = ptr;
+}
+
+void ConcurrentPoolAllocator::Push(std::atomic<uint64_t>& stack, uint32_t index) {
+    Magazine& magazine = GetMagazine(index);
+    uint64_t head = stack.load(std::memory_order_relaxed);
+    uint64_t next;
+    do {
+        magazine.next.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        next = (((head >> 32) + 1) << 32) | index;
+    } while (!stack.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+}
+
+uint32_t ConcurrentPoolAllocator::Pop(std::atomic<uint64_t>& stack) {
+    uint64_t head = stack.load(std::memory_order_acquire);
+    for (;;) {
+        uint32_t index = static_cast<uint32_t>(head);
+        if (index == INVALID_MAGAZINE) return INVALID_MAGAZINE;
+
+        // May read a link another thread is rewriting; the tag makes that CAS fail
+        uint32_t nextIndex = GetMagazine(index).next.load(std::memory_order_relaxed);
+        uint64_t next = (((head >> 32) + 1) << 32) | nextIndex;
+        if (stack.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire)) {
+            return index;
+        }
+    }
+}
+
+uint32_t ConcurrentPoolAllocator::TakeFullMagazine() {
+    uint32_t index = Pop(m_FullMagazines);
+    if (index != INVALID_MAGAZINE) return index;
+
+    std::lock_guard<std::mutex> lock(m_GrowMutex);
+
+    // Another thread may have grown the pool (or returned objects) meanwhile
+    index = Pop(m_FullMagazines);
+    if (index != INVALID_MAGAZINE) return index;
+
+    char* slab = static_cast<char*>(::operator new(m_SlabBytes, std::align_val_t(m_ObjectAlignment)));
+    ARCH_TRACK_ALLOC(slab, m_SlabBytes, m_Tag);
+    m_Slabs.push_back(slab);
+    m_ReservedBytes.fetch_add(m_SlabBytes, std::memory_order_relaxed);
+
+    CarveSlabLocked(slab);
+    return Pop(m_FullMagazines);
+}
+
+uint32_t ConcurrentPoolAllocator::TakeEmptyMagazine() {
+    uint32_t index = Pop(m_EmptyMagazines);
+    if (index != INVALID_MAGAZINE) return index;
+
+    std::lock_guard<std::mutex> lock(m_GrowMutex);
+    return CreateMagazineLocked();
+}
+
+uint32_t ConcurrentPoolAllocator::CreateMagazineLocked() {
+    uint32_t index = m_MagazineCount;
+    uint32_t chunk = index / MAGAZINES_PER_CHUNK;
+    assert(chunk < MAX_MAGAZINE_CHUNKS && "ConcurrentPoolAllocator out of magazines");
+
+    if (!m_MagazineChunks[chunk].load(std::memory_order_relaxed)) {
+        Magazine* magazines = ARCH_NEW(m_Tag) Magazine[MAGAZINES_PER_CHUNK];
+        m_MagazineChunks[chunk].store(magazines, std::memory_order_release);
+        m_ReservedBytes.fetch_add(sizeof(Magazine) * MAGAZINES_PER_CHUNK, std::memory_order_relaxed);
+    }
+
+    ++m_MagazineCount;
+    GetMagazine(index).count = 0;
+    return index;
+}
+
+void ConcurrentPoolAllocator::CarveSlabLocked(char* slab) {
+#if ARCH_POOL_DEBUG
+    std::memset(slab, FREED_PATTERN, m_SlabBytes);
+#endif
+
+    for (uint32_t i = 0; i < MAGAZINES_PER_SLAB; ++i) {
+        uint32_t index = Pop(m_EmptyMagazines);
+        if (index == INVALID_MAGAZINE) {
+            index = CreateMagazineLocked();
+        }
+
+        Magazine& magazine = GetMagazine(index);
+        char* first = slab + static_cast<size_t>(i) * MAGAZINE_SIZE * m_ObjectSize;
+        for (uint32_t j = 0; j < MAGAZINE_SIZE; ++j) {
+            // Reversed so objects are handed out in address order
+            magazine.objects[j] = first + static_cast<size_t>(MAGAZINE_SIZE - 1 - j) * m_ObjectSize;
+        }
+        magazine.count = MAGAZINE_SIZE;
+        Push(m_FullMagazines, index);
+    }
+}
+
+void ConcurrentPoolAllocator::Reset() {
+    std::lock_guard<std::mutex> lock(m_GrowMutex);
+
+    for (ThreadCache& cache : m_Caches) {
+        cache = ThreadCache();
+    }
+    m_SharedCache = ThreadCache();
+
+    m_FullMagazines.store(EMPTY_STACK, std::memory_order_relaxed);
+    m_EmptyMagazines.store(EMPTY_STACK, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < m_MagazineCount; ++i) {
+        GetMagazine(i).count = 0;
+        Push(m_EmptyMagazines, i);
+    }
+
+    for (char* slab : m_Slabs) {
+        CarveSlabLocked(slab);
+    }
+}
+
+} // namespace Archura
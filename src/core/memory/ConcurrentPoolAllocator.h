@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Allocator.h"
+#include "MemoryTracker.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Archura {
+
+/**
+ * @brief ConcurrentPoolAllocator - Fixed-size pool for allocating on one thread and freeing on another
+ *
+ * Every thread owns a cache of two magazines (arrays of up to MAGAZINE_SIZE
+ * free objects). Allocate and Free only touch the calling thread's cache, so
+ * the common path has no atomics or locks. When the cache runs dry or
+ * overflows, whole magazines move through a global depot: two lock-free
+ * stacks (full and empty magazines) addressed by index with an ABA tag.
+ *
+ * Any thread may free any object; the object simply joins the freeing
+ * thread's cache. Only growth (a new slab of objects, or magazine storage)
+ * takes a mutex.
+ *
+ * Thread caches are indexed by a per-thread slot that is recycled when a
+ * thread exits; objects cached by a dead thread are inherited by the next
+ * thread that gets its slot. Threads beyond MAX_THREADS share one locked
+ * cache. Memory is returned to the system only when the allocator is
+ * destroyed.
+ */
+class ConcurrentPoolAllocator : public Allocator {
+public:
+    static constexpr uint32_t MAX_THREADS = 64;
+    static constexpr uint32_t MAGAZINE_SIZE = 64;
+    static constexpr uint32_t MAGAZINES_PER_SLAB = 4;
+
+    ConcurrentPoolAllocator(size_t objectSize, size_t objectAlignment, MemoryTag tag = MemoryTag::General);
+    ~ConcurrentPoolAllocator() override;
+
+    ConcurrentPoolAllocator(const ConcurrentPoolAllocator&) = delete;
+    ConcurrentPoolAllocator& operator=(const ConcurrentPoolAllocator&) = delete;
+
+    // size/alignment must not exceed the pool's object size/alignment
+    void* Allocate(size_t size, size_t alignment = 8) override;
+    void Free(void* ptr) override;
+
+    // Frees every object at once; no other thread may use the allocator meanwhile
+    void Reset() override;
+
+    size_t GetObjectSize() const { return m_ObjectSize; }
+    size_t GetObjectAlignment() const { return m_ObjectAlignment; }
+    size_t GetReservedMemory() const { return m_ReservedBytes.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr uint32_t INVALID_MAGAZINE = 0xFFFFFFFFu;
+    static constexpr uint32_t MAGAZINES_PER_CHUNK = 64;
+    static constexpr uint32_t MAX_MAGAZINE_CHUNKS = 1024;
+
+    struct Magazine {
+        std::atomic<uint32_t> next{INVALID_MAGAZINE};  // Depot link; read racily by Pop, hence atomic
+        uint32_t count = 0;
+        void* objects[MAGAZINE_SIZE];
+    };
+
+    // Owned by one thread (or m_SharedMutex); padded so caches never share a line
+    struct alignas(64) ThreadCache {
+        uint32_t loaded = INVALID_MAGAZINE;
+        uint32_t previous = INVALID_MAGAZINE;
+    };
+
+    void* AllocateFrom(ThreadCache& cache);
+    void FreeTo(ThreadCache& cache, void* ptr);
+
+    // Depot: Treiber stacks of magazine indices, head = (tag << 32) | index
+    void Push(std::atomic<uint64_t>& stack, uint32_t index);
+    uint32_t Pop(std::atomic<uint64_t>& stack);
+
+    uint32_t TakeFullMagazine();
+    uint32_t TakeEmptyMagazine();
+    uint32_t CreateMagazineLocked();
+    void CarveSlabLocked(char* slab);
+
+    Magazine& GetMagazine(uint32_t index) const {
+        return m_MagazineChunks[index / MAGAZINES_PER_CHUNK].load(std::memory_order_acquire)[index % MAGAZINES_PER_CHUNK];
+    }
+
+    size_t m_ObjectSize;
+    size_t m_ObjectAlignment;
+    size_t m_SlabBytes;
+    MemoryTag m_Tag;
+
+    std::array<ThreadCache, MAX_THREADS> m_Caches;
+    ThreadCache m_SharedCache;
+    std::mutex m_SharedMutex;
+
+    alignas(64) std::atomic<uint64_t> m_FullMagazines;
+    alignas(64) std::atomic<uint64_t> m_EmptyMagazines;
+
+    // Growth only
+    alignas(64) std::mutex m_GrowMutex;
+    std::array<std::atomic<Magazine*>, MAX_MAGAZINE_CHUNKS> m_MagazineChunks{};
+    uint32_t m_MagazineCount = 0;
+    std::vector<char*> m_Slabs;
+    std::atomic<size_t> m_ReservedBytes{0};
+};
+
+} // namespace Archura
@@ -0,0 +1,170 @@
+#include "FrameAllocator.h"
+#include "HeapStats.h"
+#include "VirtualArena.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace Archura {
+
+namespace {
+
+struct OverflowBlock {
+    void* ptr;
+    size_t alignment;
+};
+
+struct ThreadArena {
+    std::unique_ptr<VirtualArena> buffers[2];
+    uint64_t bufferFrame[2] = { UINT64_MAX, UINT64_MAX };
+    std::vector<OverflowBlock> overflow[2];
+    size_t overflowBytes[2] = {};
+
+    // Read by EndFrame/GetStats on the main thread
+    std::atomic<uint64_t> frame{UINT64_MAX};
+    std::atomic<size_t> used{0};
+    std::atomic<size_t> committed{0};
+    std::atomic<size_t> reserved{0};
+    std::atomic<uint32_t> overflowCount{0};
+    std::atomic<bool> owned{false};
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadArena>> arenas;
+};
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+std::atomic<uint64_t> s_FrameIndex{0};
+
+// Written by EndFrame only (main thread)
+FrameAllocatorStats s_LastFrame;
+uint64_t s_HeapAllocationsAtFrameStart = 0;
+uint64_t s_HeapBytesAtFrameStart = 0;
+
+// Releases the arena for reuse when its thread exits (memory is kept)
+struct ArenaHandle {
+    ThreadArena* arena = nullptr;
+    ~ArenaHandle() {
+        if (arena) arena->owned.store(false, std::memory_order_release);
+    }
+};
+
+thread_local ArenaHandle t_Arena;
+
+ThreadArena& GetThreadArena() {
+    if (t_Arena.arena) return *t_Arena.arena;
+
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    for (auto& arena : registry.arenas) {
+        bool expected = false;
+        if (arena->owned.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            t_Arena.arena = arena.get();
+            return *t_Arena.arena;
+        }
+    }
+
+    auto arena = std::make_unique<ThreadArena>();
+    for (auto& buffer : arena->buffers) {
+        buffer = std::make_unique<VirtualArena>(FrameAllocator::ARENA_RESERVE_SIZE, FrameAllocator::DEFAULT_ARENA_SIZE);
+    }
+    arena->reserved.store(arena->buffers[0]->GetReserved() + arena->buffers[1]->GetReserved(), std::memory_order_relaxed);
+    arena->owned.store(true, std::memory_order_relaxed);
+    t_Arena.arena = arena.get();
+    registry.arenas.push_back(std::move(arena));
+    return *t_Arena.arena;
+}
+
+// The buffer was last used two frames ago: nothing can reference it anymore
+void ResetBuffer(ThreadArena& arena, uint32_t index, uint64_t frame) {
+    for (const OverflowBlock& block : arena.overflow[index]) {
+        ::operator delete(block.ptr, std::align_val_t(block.alignment));
+    }
+    arena.overflow[index].clear();
+    arena.overflowBytes[index] = 0;
+
+    // Pages above what this buffer used last time (and DEFAULT_ARENA_SIZE) are decommitted
+    arena.buffers[index]->Reset();
+
+    arena.bufferFrame[index] = frame;
+    arena.used.store(0, std::memory_order_relaxed);
+    arena.committed.store(arena.buffers[0]->GetCommitted() + arena.buffers[1]->GetCommitted(), std::memory_order_relaxed);
+    arena.overflowCount.store(0, std::memory_order_relaxed);
+    arena.frame.store(frame, std::memory_order_relaxed);
+}
+
+} // namespace
+
+void* FrameAllocator::Allocate(size_t size, size_t alignment) {
+    ThreadArena& arena = GetThreadArena();
+
+    uint64_t frame = s_FrameIndex.load(std::memory_order_acquire);
+    uint32_t index = static_cast<uint32_t>(frame & 1);
+    if (arena.bufferFrame[index] != frame) {
+        ResetBuffer(arena, index, frame);
+    }
+
+    VirtualArena& buffer = *arena.buffers[index];
+    size_t committed = buffer.GetCommitted();
+    void* ptr = buffer.Allocate(size, alignment);
+    if (!ptr) {
+        // Reservation exhausted: heap for the rest of this frame, released on reset
+        ptr = ::operator new(size, std::align_val_t(alignment));
+        arena.overflow[index].push_back({ ptr, alignment });
+        arena.overflowBytes[index] += size + alignment;
+        arena.overflowCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (buffer.GetCommitted() != committed) {
+        arena.committed.fetch_add(buffer.GetCommitted() - committed, std::memory_order_relaxed);
+    }
+    arena.used.store(buffer.GetUsed() + arena.overflowBytes[index], std::memory_order_relaxed);
+    return ptr;
+}
+
+void FrameAllocator::EndFrame() {
+    uint64_t frame = s_FrameIndex.load(std::memory_order_relaxed);
+
+    FrameAllocatorStats stats;
+    stats.frameIndex = frame;
+    {
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        stats.threadCount = static_cast<uint32_t>(registry.arenas.size());
+        for (const auto& arena : registry.arenas) {
+            stats.committedBytes += arena->committed.load(std::memory_order_relaxed);
+            stats.reservedBytes += arena->reserved.load(std::memory_order_relaxed);
+            if (arena->frame.load(std::memory_order_relaxed) != frame) continue;
+            stats.usedBytes += arena->used.load(std::memory_order_relaxed);
+            stats.overflowAllocations += arena->overflowCount.load(std::memory_order_relaxed);
+        }
+    }
+    stats.peakBytes = std::max(s_LastFrame.peakBytes, stats.usedBytes);
+
+    uint64_t heapAllocations = HeapStats::GetAllocationCount();
+    uint64_t heapBytes = HeapStats::GetAllocatedBytes();
+    stats.heapAllocations = heapAllocations - s_HeapAllocationsAtFrameStart;
+    stats.heapBytes = heapBytes - s_HeapBytesAtFrameStart;
+    s_HeapAllocationsAtFrameStart = heapAllocations;
+    s_HeapBytesAtFrameStart = heapBytes;
+
+    s_LastFrame = stats;
+    s_FrameIndex.store(frame + 1, std::memory_order_release);
+}
+
+uint64_t FrameAllocator::GetFrameIndex() {
+    return s_FrameIndex.load(std::memory_order_acquire);
+}
+
+void FrameAllocator::GetStats(FrameAllocatorStats& outStats) {
+    outStats = s_LastFrame;
+}
+
+} // namespace Archura
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace Archura {
+
+struct FrameAllocatorStats {
+    uint64_t frameIndex = 0;
+    uint32_t threadCount = 0;          // Threads that own an arena
+    size_t usedBytes = 0;              // Last completed frame, all threads
+    size_t peakBytes = 0;              // Highest usedBytes seen so far
+    size_t committedBytes = 0;         // Resident arena memory, all buffers (2 per thread)
+    size_t reservedBytes = 0;          // Address space reserved for all buffers
+    uint32_t overflowAllocations = 0;  // Last frame: served from the heap because an arena reservation was full
+    uint64_t heapAllocations = 0;      // Last frame: global operator new calls (HeapStats)
+    uint64_t heapBytes = 0;
+};
+
+/**
+ * @brief FrameAllocator - Per-thread, double-buffered linear arena for frame-temporary data
+ *
+ * Every thread that allocates gets two VirtualArenas; frame N bumps buffer
+ * N % 2. Memory allocated during frame N stays valid until the end of frame
+ * N + 1, so data may be handed from one frame to the next (e.g. simulation ->
+ * render), but never kept longer. There is no individual free.
+ *
+ * Allocation is lock-free (thread-local). EndFrame() only advances the frame
+ * index; each thread resets its buffer lazily on its first allocation of the
+ * new frame. Each buffer reserves ARENA_RESERVE_SIZE of address space and
+ * commits pages as the frame needs them, so a heavy frame just commits more;
+ * a reset decommits what the previous use of the buffer did not need (but
+ * keeps DEFAULT_ARENA_SIZE). Only an exhausted reservation falls back to the
+ * heap for the rest of the frame.
+ */
+class FrameAllocator {
+public:
+    static constexpr size_t DEFAULT_ARENA_SIZE = 1024 * 1024;        // Always kept committed
+    static constexpr size_t ARENA_RESERVE_SIZE = 256 * 1024 * 1024;  // Address space per buffer
+
+    static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    template<typename T>
+    static T* AllocateArray(size_t count) {
+        return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    // Main thread, once per frame after all frame work (jobs, rendering) has finished
+    static void EndFrame();
+
+    static uint64_t GetFrameIndex();
+    static void GetStats(FrameAllocatorStats& outStats);
+};
+
+/**
+ * @brief FrameSTLAllocator - STL allocator adapter over FrameAllocator
+ *
+ * deallocate is a no-op; containers must not outlive the next frame. Growth
+ * leaves the old block behind in the arena, so reserve() where the size is known.
+ */
+template<typename T>
+class FrameSTLAllocator {
+public:
+    using value_type = T;
+
+    FrameSTLAllocator() noexcept = default;
+    template<typename U>
+    FrameSTLAllocator(const FrameSTLAllocator<U>&) noexcept {}
+
+    T* allocate(size_t count) {
+        return FrameAllocator::AllocateArray<T>(count);
+    }
+
+    void deallocate(T*, size_t) noexcept {}
+
+    template<typename U>
+    bool operator==(const FrameSTLAllocator<U>&) const noexcept { return true; }
+    template<typename U>
+    bool operator!=(const FrameSTLAllocator<U>&) const noexcept { return false; }
+};
+
+template<typename T>
+using FrameVector = std::vector<T, FrameSTLAllocator<T>>;
+
+} // namespace Archura
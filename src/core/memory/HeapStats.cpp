@@ -0,0 +1,120 @@
+#include "HeapStats.h"
+#include "MemoryTracker.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace Archura {
+
+namespace {
+    // Relaxed: only totals matter, ordering with other memory does not
+    std::atomic<uint64_t> s_Allocations{0};
+    std::atomic<uint64_t> s_AllocatedBytes{0};
+    std::atomic<uint64_t> s_Frees{0};
+
+    void* CountedAllocate(size_t size) {
+        s_Allocations.fetch_add(1, std::memory_order_relaxed);
+        s_AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        return std::malloc(size ? size : 1);
+    }
+
+    void* CountedAllocateAligned(size_t size, size_t alignment) {
+        s_Allocations.fetch_add(1, std::memory_order_relaxed);
+        s_AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+#ifdef _MSC_VER
+        return _aligned_malloc(size ? size : 1, alignment);
+#else
+        // aligned_alloc requires a size that is a multiple of the alignment
+        size_t rounded = ((size ? size : 1) + alignment - 1) & ~(alignment - 1);
+        return std::aligned_alloc(alignment, rounded);
+#endif
+    }
+
+    void CountedFree(void* ptr) {
+        if (!ptr) return;
+#if ARCH_MEMORY_TRACKING
+        MemoryTracker::Untrack(ptr);
+#endif
+        s_Frees.fetch_add(1, std::memory_order_relaxed);
+        std::free(ptr);
+    }
+
+    void CountedFreeAligned(void* ptr) {
+        if (!ptr) return;
+#if ARCH_MEMORY_TRACKING
+        MemoryTracker::Untrack(ptr);
+#endif
+        s_Frees.fetch_add(1, std::memory_order_relaxed);
+#ifdef _MSC_VER
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+}
+
+uint64_t HeapStats::GetAllocationCount() {
+    return s_Allocations.load(std::memory_order_relaxed);
+}
+
+uint64_t HeapStats::GetAllocatedBytes() {
+    return s_AllocatedBytes.load(std::memory_order_relaxed);
+}
+
+uint64_t HeapStats::GetFreeCount() {
+    return s_Frees.load(std::memory_order_relaxed);
+}
+
+} // namespace Archura
+
+// Global replacements (must live in exactly one translation unit)
+
+void* operator new(size_t size) {
+    if (void* ptr = Archura::CountedAllocate(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    if (void* ptr = Archura::CountedAllocate(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return Archura::CountedAllocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return Archura::CountedAllocate(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    if (void* ptr = Archura::CountedAllocateAligned(size, static_cast<size_t>(alignment))) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    if (void* ptr = Archura::CountedAllocateAligned(size, static_cast<size_t>(alignment))) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return Archura::CountedAllocateAligned(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return Archura::CountedAllocateAligned(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept { Archura::CountedFree(ptr); }
+void operator delete[](void* ptr) noexcept { Archura::CountedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { Archura::CountedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { Archura::CountedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { Archura::CountedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { Archura::CountedFree(ptr); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept { Archura::CountedFreeAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { Archura::CountedFreeAligned(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { Archura::CountedFreeAligned(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { Archura::CountedFreeAligned(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { Archura::CountedFreeAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { Archura::CountedFreeAligned(ptr); }
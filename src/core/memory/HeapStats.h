@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Archura {
+
+/**
+ * @brief HeapStats - Counters for every global operator new/delete call
+ *
+ * HeapStats.cpp replaces the global allocation operators, so everything that
+ * goes through new/delete (STL containers, std::string, std::function, ...) is
+ * counted. Direct malloc users (ImGui, drivers) are not. Counters are
+ * cumulative; per-frame numbers are taken as differences (see FrameAllocator).
+ * Frees also retire MemoryTracker records, so tagged memory may be released
+ * with plain delete.
+ */
+class HeapStats {
+public:
+    static uint64_t GetAllocationCount();
+    static uint64_t GetAllocatedBytes();
+    static uint64_t GetFreeCount();
+};
+
+} // namespace Archura
@@ -0,0 +1,126 @@
+#include "MemoryResource.h"
+#include "FrameAllocator.h"
+#include "PoolAllocator.h"
+#include "StackAllocator.h"
+#include <algorithm>
+#include <new>
+
+namespace Archura {
+
+// ==================== StackResource ====================
+
+StackResource::StackResource(StackAllocator& stack, std::pmr::memory_resource* upstream)
+    : m_Stack(stack)
+    , m_Upstream(upstream)
+{
+}
+
+void* StackResource::do_allocate(size_t bytes, size_t alignment) {
+    if (void* ptr = m_Stack.Allocate(bytes, alignment)) {
+        return ptr;
+    }
+    return m_Upstream->allocate(bytes, alignment);
+}
+
+void StackResource::do_deallocate(void* ptr, size_t bytes, size_t alignment) {
+    // Stack memory is released in bulk by the owner of the StackAllocator
+    if (!m_Stack.Owns(ptr)) {
+        m_Upstream->deallocate(ptr, bytes, alignment);
+    }
+}
+
+// ==================== PoolResource ====================
+
+PoolResource::PoolResource(PoolAllocator& pool, std::pmr::memory_resource* upstream)
+    : m_Pool(pool)
+    , m_Upstream(upstream)
+{
+}
+
+bool PoolResource::Fits(size_t bytes, size_t alignment) const {
+    return bytes <= m_Pool.GetObjectSize() && alignment <= m_Pool.GetObjectAlignment();
+}
+
+void* PoolResource::do_allocate(size_t bytes, size_t alignment) {
+    if (Fits(bytes, alignment)) {
+        return m_Pool.Allocate(bytes, alignment);
+    }
+    return m_Upstream->allocate(bytes, alignment);
+}
+
+void PoolResource::do_deallocate(void* ptr, size_t bytes, size_t alignment) {
+    // pmr passes the original size/alignment, so the same test picks the same source
+    if (Fits(bytes, alignment)) {
+        m_Pool.Free(ptr);
+    } else {
+        m_Upstream->deallocate(ptr, bytes, alignment);
+    }
+}
+
+// ==================== FrameResource ====================
+
+FrameResource& FrameResource::Get() {
+    static FrameResource instance;
+    return instance;
+}
+
+void* FrameResource::do_allocate(size_t bytes, size_t alignment) {
+    return FrameAllocator::Allocate(bytes, alignment);
+}
+
+// ==================== UnsynchronizedPoolResource ====================
+
+UnsynchronizedPoolResource::UnsynchronizedPoolResource(std::pmr::memory_resource* upstream)
+    : m_Upstream(upstream)
+{
+}
+
+UnsynchronizedPoolResource::~UnsynchronizedPoolResource() = default;
+
+size_t UnsynchronizedPoolResource::GetClass(size_t bytes, size_t alignment) {
+    size_t size = std::max({ bytes, alignment, MIN_POOLED_SIZE });
+    if (size > MAX_POOLED_SIZE || alignment > MAX_POOLED_ALIGNMENT) {
+        return CLASS_COUNT;
+    }
+
+    size_t index = 0;
+    for (size_t classSize = MIN_POOLED_SIZE; classSize < size; classSize <<= 1) {
+        ++index;
+    }
+    return index;
+}
+
+void* UnsynchronizedPoolResource::do_allocate(size_t bytes, size_t alignment) {
+    size_t index = GetClass(bytes, alignment);
+    if (index == CLASS_COUNT) {
+        return m_Upstream->allocate(bytes, alignment);
+    }
+
+    std::unique_ptr<PoolAllocator>& pool = m_Pools[index];
+    if (!pool) {
+        // Slots are aligned to their size (capped), blocks hold at least 32 slots
+        size_t classSize = MIN_POOLED_SIZE << index;
+        size_t classAlignment = std::min(classSize, MAX_POOLED_ALIGNMENT);
+        pool = std::make_unique<PoolAllocator>(classSize, classAlignment, std::max<size_t>(4096, classSize * 32));
+    }
+    return pool->Allocate(bytes, alignment);
+}
+
+void UnsynchronizedPoolResource::do_deallocate(void* ptr, size_t bytes, size_t alignment) {
+    size_t index = GetClass(bytes, alignment);
+    if (index == CLASS_COUNT) {
+        m_Upstream->deallocate(ptr, bytes, alignment);
+        return;
+    }
+    m_Pools[index]->Free(ptr);
+}
+
+size_t UnsynchronizedPoolResource::GetReservedBytes() const {
+    size_t bytes = 0;
+    for (const auto& pool : m_Pools) {
+        if (pool) bytes += pool->GetReservedMemory();
+    }
+    return bytes;
+}
+
+} // namespace Archura
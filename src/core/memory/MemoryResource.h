@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace Archura {
+
+class PoolAllocator;
+class StackAllocator;
+
+/**
+ * std::pmr::memory_resource adapters for the engine allocators.
+ *
+ * Containers switch to an arena by becoming std::pmr::vector / std::pmr::string /
+ * std::pmr::unordered_map etc. and taking the resource in their constructor;
+ * the rest of the code is unchanged. None of these resources are thread-safe
+ * except FrameResource (per-thread arenas).
+ */
+
+// StackAllocator-backed; deallocate is a no-op (free with Reset/FreeToMarker on the
+// allocator). Requests that do not fit go to the upstream resource.
+class StackResource : public std::pmr::memory_resource {
+public:
+    explicit StackResource(StackAllocator& stack, std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    StackAllocator& m_Stack;
+    std::pmr::memory_resource* m_Upstream;
+};
+
+// PoolAllocator-backed for requests up to the pool's object size/alignment,
+// everything else goes to the upstream resource.
+class PoolResource : public std::pmr::memory_resource {
+public:
+    explicit PoolResource(PoolAllocator& pool, std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+private:
+    bool Fits(size_t bytes, size_t alignment) const;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    PoolAllocator& m_Pool;
+    std::pmr::memory_resource* m_Upstream;
+};
+
+// Monotonic resource over FrameAllocator: memory lives until the end of the next
+// frame, deallocate is a no-op. Safe from any thread (each thread bumps its own arena).
+class FrameResource : public std::pmr::memory_resource {
+public:
+    static FrameResource& Get();
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// Unsynchronized pool resource: one growable PoolAllocator per power-of-two size
+// class (16..MAX_POOLED_SIZE bytes), created on first use. Larger or over-aligned
+// requests go to the upstream resource. Memory is returned to the pools on
+// deallocate and to the system when the resource is destroyed.
+class UnsynchronizedPoolResource : public std::pmr::memory_resource {
+public:
+    static constexpr size_t MIN_POOLED_SIZE = 16;
+    static constexpr size_t MAX_POOLED_SIZE = 512;
+    static constexpr size_t MAX_POOLED_ALIGNMENT = 64;
+
+    explicit UnsynchronizedPoolResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+    ~UnsynchronizedPoolResource() override;
+
+    UnsynchronizedPoolResource(const UnsynchronizedPoolResource&) = delete;
+    UnsynchronizedPoolResource& operator=(const UnsynchronizedPoolResource&) = delete;
+
+    // Bytes held by the size-class pools (used + free slots)
+    size_t GetReservedBytes() const;
+
+private:
+    static constexpr size_t CLASS_COUNT = 6;  // 16, 32, 64, 128, 256, 512
+
+    // Size class index, or CLASS_COUNT if the request goes upstream
+    static size_t GetClass(size_t bytes, size_t alignment);
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    std::array<std::unique_ptr<PoolAllocator>, CLASS_COUNT> m_Pools;
+    std::pmr::memory_resource* m_Upstream;
+};
+
+} // namespace Archura
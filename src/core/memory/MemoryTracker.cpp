@@ -0,0 +1,275 @@
+#include "MemoryTracker.h"
+
+#if ARCH_MEMORY_TRACKING
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Archura {
+
+namespace {
+
+constexpr size_t TAG_COUNT = static_cast<size_t>(MemoryTag::Count);
+constexpr size_t SHARD_COUNT = 16;
+
+const char* const TAG_NAMES[TAG_COUNT] = {
+    "General", "Rendering", "ECS", "Physics", "Audio", "Network", "Assets"
+};
+
+// The tracker's own containers must not go through operator new/delete:
+// a delete inside a locked shard would re-enter Untrack on the same shard
+template<typename T>
+struct MallocAllocator {
+    using value_type = T;
+
+    MallocAllocator() = default;
+    template<typename U>
+    MallocAllocator(const MallocAllocator<U>&) noexcept {}
+
+    T* allocate(size_t count) {
+        if (void* ptr = std::malloc(count * sizeof(T))) return static_cast<T*>(ptr);
+        throw std::bad_alloc();
+    }
+    void deallocate(T* ptr, size_t) noexcept { std::free(ptr); }
+
+    template<typename U>
+    bool operator==(const MallocAllocator<U>&) const noexcept { return true; }
+    template<typename U>
+    bool operator!=(const MallocAllocator<U>&) const noexcept { return false; }
+};
+
+struct Record {
+    size_t size;
+    const char* file;
+    int line;
+    MemoryTag tag;
+};
+
+using RecordMap = std::unordered_map<const void*, Record, std::hash<const void*>, std::equal_to<const void*>,
+                                     MallocAllocator<std::pair<const void* const, Record>>>;
+
+struct alignas(64) Shard {
+    std::mutex mutex;
+    RecordMap records;
+};
+
+struct TagCounters {
+    std::atomic<size_t> liveBytes{0};
+    std::atomic<size_t> peakBytes{0};
+    std::atomic<size_t> liveAllocations{0};
+    std::atomic<uint64_t> totalAllocations{0};
+    std::atomic<size_t> budgetBytes{0};
+    std::atomic<bool> overBudget{false};
+};
+
+struct TrackerState {
+    Shard shards[SHARD_COUNT];
+    TagCounters tags[TAG_COUNT];
+};
+
+// Untracked frees skip the shard lookup entirely while nothing is tracked
+std::atomic<size_t> s_LiveAllocations{0};
+
+// Never destroyed: frees keep arriving during static destruction
+TrackerState& GetState() {
+    alignas(TrackerState) static unsigned char storage[sizeof(TrackerState)];
+    static TrackerState* state = new (storage) TrackerState();
+    return *state;
+}
+
+Shard& GetShard(TrackerState& state, const void* ptr) {
+    // Low bits are alignment; mix the rest so neighbouring blocks spread over shards
+    uintptr_t key = reinterpret_cast<uintptr_t>(ptr) >> 4;
+    key ^= key >> 7;
+    return state.shards[key % SHARD_COUNT];
+}
+
+void AddToTag(MemoryTag tag, size_t size, bool newAllocation) {
+    TagCounters& counters = GetState().tags[static_cast<size_t>(tag)];
+    size_t live = counters.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    counters.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (newAllocation) {
+        counters.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    size_t peak = counters.peakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !counters.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+
+    size_t budget = counters.budgetBytes.load(std::memory_order_relaxed);
+    if (budget != 0 && live > budget && !counters.overBudget.exchange(true, std::memory_order_relaxed)) {
+        std::fprintf(stderr, "[MemoryTracker] WARNING: %s over budget: %zu KB live, budget %zu KB\n",
+            TAG_NAMES[static_cast<size_t>(tag)], live / 1024, budget / 1024);
+    }
+}
+
+void RemoveFromTag(MemoryTag tag, size_t size) {
+    TagCounters& counters = GetState().tags[static_cast<size_t>(tag)];
+    size_t live = counters.liveBytes.fetch_sub(size, std::memory_order_relaxed) - size;
+    counters.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+
+    if (live <= counters.budgetBytes.load(std::memory_order_relaxed)) {
+        counters.overBudget.store(false, std::memory_order_relaxed);
+    }
+}
+
+} // namespace
+
+void MemoryTracker::Track(void* ptr, size_t size, MemoryTag tag, const char* file, int line) {
+    if (!ptr) return;
+
+    TrackerState& state = GetState();
+    Shard& shard = GetShard(state, ptr);
+
+    Record replaced{};
+    bool hadRecord = false;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto [it, inserted] = shard.records.try_emplace(ptr, Record{ size, file, line, tag });
+        if (!inserted) {
+            // Already tracked: the record is updated (e.g. a virtual arena that committed more)
+            replaced = it->second;
+            hadRecord = true;
+            it->second = Record{ size, file, line, tag };
+        }
+    }
+
+    if (hadRecord) {
+        RemoveFromTag(replaced.tag, replaced.size);
+    } else {
+        s_LiveAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    AddToTag(tag, size, !hadRecord);
+}
+
+void MemoryTracker::Untrack(void* ptr) {
+    if (!ptr || s_LiveAllocations.load(std::memory_order_relaxed) == 0) return;
+
+    Shard& shard = GetShard(GetState(), ptr);
+
+    Record record;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.records.find(ptr);
+        if (it == shard.records.end()) return;
+        record = it->second;
+        shard.records.erase(it);
+    }
+
+    s_LiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+    RemoveFromTag(record.tag, record.size);
+}
+
+void MemoryTracker::SetBudget(MemoryTag tag, size_t bytes) {
+    TagCounters& counters = GetState().tags[static_cast<size_t>(tag)];
+    counters.budgetBytes.store(bytes, std::memory_order_relaxed);
+    counters.overBudget.store(false, std::memory_order_relaxed);
+}
+
+void MemoryTracker::GetStats(MemoryTag tag, MemoryTagStats& outStats) {
+    const TagCounters& counters = GetState().tags[static_cast<size_t>(tag)];
+    outStats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+    outStats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+    outStats.liveAllocations = counters.liveAllocations.load(std::memory_order_relaxed);
+    outStats.totalAllocations = counters.totalAllocations.load(std::memory_order_relaxed);
+    outStats.budgetBytes = counters.budgetBytes.load(std::memory_order_relaxed);
+}
+
+size_t MemoryTracker::ReportLeaks() {
+    struct Site {
+        const char* file;
+        int line;
+        MemoryTag tag;
+        size_t count;
+        size_t bytes;
+    };
+    std::vector<Site, MallocAllocator<Site>> sites;
+
+    size_t totalCount = 0;
+    size_t totalBytes = 0;
+
+    TrackerState& state = GetState();
+    for (Shard& shard : state.shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (const auto& [ptr, record] : shard.records) {
+            auto it = std::find_if(sites.begin(), sites.end(), [&](const Site& site) {
+                return site.line == record.line && site.tag == record.tag && (site.file == record.file || std::strcmp(site.file, record.file) == 0);
+            });
+            if (it == sites.end()) {
+                sites.push_back(Site{ record.file, record.line, record.tag, 0, 0 });
+                it = sites.end() - 1;
+            }
+            ++it->count;
+            it->bytes += record.size;
+            ++totalCount;
+            totalBytes += record.size;
+        }
+    }
+
+    if (totalCount == 0) {
+        std::fprintf(stderr, "[MemoryTracker] No leaks\n");
+        return 0;
+    }
+
+    std::sort(sites.begin(), sites.end(), [](const Site& a, const Site& b) { return a.bytes > b.bytes; });
+
+    std::fprintf(stderr, "[MemoryTracker] %zu allocations (%zu bytes) still live at shutdown:\n", totalCount, totalBytes);
+    for (const Site& site : sites) {
+        std::fprintf(stderr, "  %-9s %6zu x %10zu bytes  %s:%d\n",
+            TAG_NAMES[static_cast<size_t>(site.tag)], site.count, site.bytes, site.file, site.line);
+    }
+    return totalCount;
+}
+
+const char* MemoryTracker::GetTagName(MemoryTag tag) {
+    size_t index = static_cast<size_t>(tag);
+    return index < TAG_COUNT ? TAG_NAMES[index] : "Unknown";
+}
+
+bool MemoryTracker::ParseTag(const char* name, MemoryTag& outTag) {
+    for (size_t i = 0; i < TAG_COUNT; ++i) {
+        const char* a = name;
+        const char* b = TAG_NAMES[i];
+        while (*a && *b && std::tolower(static_cast<unsigned char>(*a)) == std::tolower(static_cast<unsigned char>(*b))) {
+            ++a;
+            ++b;
+        }
+        if (*a == '\0' && *b == '\0') {
+            outTag = static_cast<MemoryTag>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace Archura
+
+void* operator new(size_t size, const Archura::MemorySite& site) {
+    void* ptr = ::operator new(size);
+    Archura::MemoryTracker::Track(ptr, size, site.tag, site.file, site.line);
+    return ptr;
+}
+
+void* operator new[](size_t size, const Archura::MemorySite& site) {
+    void* ptr = ::operator new[](size);
+    Archura::MemoryTracker::Track(ptr, size, site.tag, site.file, site.line);
+    return ptr;
+}
+
+void operator delete(void* ptr, const Archura::MemorySite&) noexcept {
+    ::operator delete(ptr);
+}
+
+void operator delete[](void* ptr, const Archura::MemorySite&) noexcept {
+    ::operator delete[](ptr);
+}
+
+#endif // ARCH_MEMORY_TRACKING
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+// Tagged allocation tracking (on in debug builds); with 0 every macro below
+// expands to plain new / nothing and MemoryTracker.cpp compiles to nothing
+#ifndef ARCH_MEMORY_TRACKING
+#ifdef _DEBUG
+#define ARCH_MEMORY_TRACKING 1
+#else
+#define ARCH_MEMORY_TRACKING 0
+#endif
+#endif
+
+namespace Archura {
+
+enum class MemoryTag : uint8_t {
+    General,
+    Rendering,
+    ECS,
+    Physics,
+    Audio,
+    Network,
+    Assets,
+    Count
+};
+
+struct MemoryTagStats {
+    size_t liveBytes = 0;
+    size_t peakBytes = 0;          // High-water mark of liveBytes
+    size_t liveAllocations = 0;
+    uint64_t totalAllocations = 0;
+    size_t budgetBytes = 0;        // 0 = no budget
+};
+
+// Allocation site passed to the tagged placement new (see ARCH_NEW)
+struct MemorySite {
+    MemoryTag tag;
+    const char* file;
+    int line;
+};
+
+/**
+ * @brief MemoryTracker - Per-subsystem live bytes, high-water marks, budgets and leak report
+ *
+ * Tracked allocations are either objects created with ARCH_NEW(tag) or raw
+ * blocks registered with ARCH_TRACK_ALLOC (pool/chunk/ring blocks from
+ * ::operator new). Both are untracked automatically when the memory goes back
+ * through the global operator delete (HeapStats.cpp), so plain delete and
+ * unique_ptr keep working. Memory released another way (malloc/free, virtual
+ * memory) must call ARCH_TRACK_FREE. Tracking a pointer again replaces its
+ * size and tag, which is how growing blocks report their new size.
+ *
+ * Crossing a tag's budget logs one warning; it re-arms once the tag drops
+ * back under the budget. ReportLeaks() lists everything still tracked,
+ * grouped by allocation site, and is meant to run after shutdown.
+ *
+ * Thread-safe. Untracked frees cost one atomic load while nothing is tracked,
+ * otherwise a lookup in one of several locked shards.
+ */
+class MemoryTracker {
+public:
+    static void Track(void* ptr, size_t size, MemoryTag tag, const char* file, int line);
+    static void Untrack(void* ptr);
+
+    static void SetBudget(MemoryTag tag, size_t bytes);
+    static void GetStats(MemoryTag tag, MemoryTagStats& outStats);
+
+    // Prints live allocations by site to stderr; returns the number of live allocations
+    static size_t ReportLeaks();
+
+    static const char* GetTagName(MemoryTag tag);
+    // Case-insensitive; returns false for unknown names
+    static bool ParseTag(const char* name, MemoryTag& outTag);
+};
+
+} // namespace Archura
+
+#if ARCH_MEMORY_TRACKING
+
+void* operator new(size_t size, const Archura::MemorySite& site);
+void* operator new[](size_t size, const Archura::MemorySite& site);
+// Only called if the constructor throws
+void operator delete(void* ptr, const Archura::MemorySite& site) noexcept;
+void operator delete[](void* ptr, const Archura::MemorySite& site) noexcept;
+
+// ARCH_NEW(MemoryTag::Rendering) Mesh(vertices, indices); freed with plain delete
+#define ARCH_NEW(tag) new (::Archura::MemorySite{ (tag), __FILE__, __LINE__ })
+#define ARCH_TRACK_ALLOC(ptr, size, tag) ::Archura::MemoryTracker::Track((ptr), (size), (tag), __FILE__, __LINE__)
+#define ARCH_TRACK_FREE(ptr) ::Archura::MemoryTracker::Untrack(ptr)
+
+#else
+
+#define ARCH_NEW(tag) new
+#define ARCH_TRACK_ALLOC(ptr, size, tag) ((void)0)
+#define ARCH_TRACK_FREE(ptr) ((void)0)
+
+#endif
@@ -1,88 +1,172 @@
 #include "PoolAllocator.h"
-#include <cstdlib>
-#include <cassert>
+#include "VirtualArena.h"
+#include <cstdint>
+#include <cstring>
 #include <algorithm> // for std::max
 #include <iostream>
 
 namespace Archura {
 
-PoolAllocator::PoolAllocator(size_t objectSize, size_t objectAlignment, size_t sizeBytes)
-    : m_ObjectSize(objectSize)
-    , m_ObjectAlignment(objectAlignment)
-    , m_Size(sizeBytes)
+namespace {
+
+constexpr unsigned char FRESH_PATTERN = 0xCD;
+constexpr unsigned char FREED_PATTERN = 0xDD;
+
+size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+size_t PoolAllocator::GetSlotSize(size_t objectSize, size_t objectAlignment) {
+    // Every slot must be able to hold the free list link and keep the next slot aligned
+    size_t alignment = std::max(objectAlignment, alignof(FreeHeader));
+    return AlignUp(std::max(objectSize, sizeof(FreeHeader)), alignment);
+}
+
+PoolAllocator::PoolAllocator(size_t objectSize, size_t objectAlignment, size_t blockSizeBytes, MemoryTag tag, VirtualArena* backing)
+    : m_ObjectSize(GetSlotSize(objectSize, objectAlignment))
+    , m_ObjectAlignment(std::max(objectAlignment, alignof(FreeHeader)))
+    , m_Tag(tag)
+    , m_Backing(backing)
 {
-    // Ensure object size is large enough to hold the pointer for free list
-    m_ObjectSize = std::max(objectSize, sizeof(FreeHeader*));
-    
-    // Allocate simple block
-    m_Start = std::malloc(m_Size);
-    Reset();
-    
+    assert(objectAlignment != 0 && (objectAlignment & (objectAlignment - 1)) == 0 && "Pool alignment must be a power of two");
+
+    m_ObjectsPerBlock = std::max<size_t>(1, blockSizeBytes / m_ObjectSize);
+    m_BlockSize = m_ObjectsPerBlock * m_ObjectSize;
+
 #ifdef _DEBUG
-    std::cout << "[PoolAllocator] Initialized. Block Size: " << m_ObjectSize << ", Capacity: " << (m_Size / m_ObjectSize) << "\n";
+    std::cout << "[PoolAllocator] Initialized. Slot Size: " << m_ObjectSize << ", Objects per Block: " << m_ObjectsPerBlock << "\n";
 #endif
 }
 
 PoolAllocator::~PoolAllocator() {
-    std::free(m_Start);
+    for (Block& block : m_Blocks) {
+        if (block.fromHeap) {
+            ::operator delete(block.data, std::align_val_t(m_ObjectAlignment));
+        }
+    }
+}
+
+void PoolAllocator::AddBlock() {
+    Block block;
+    block.data = m_Backing ? static_cast<char*>(m_Backing->Allocate(m_BlockSize, m_ObjectAlignment)) : nullptr;
+    block.fromHeap = block.data == nullptr;
+    if (block.fromHeap) {
+        block.data = static_cast<char*>(::operator new(m_BlockSize, std::align_val_t(m_ObjectAlignment)));
+        ARCH_TRACK_ALLOC(block.data, m_BlockSize, m_Tag);
+    }
+#if ARCH_POOL_DEBUG
+    block.live.assign(m_ObjectsPerBlock, false);
+#endif
+    m_Blocks.push_back(std::move(block));
+    PushBlockSlots(m_Blocks.back());
+}
+
+void PoolAllocator::PushBlockSlots(Block& block) {
+#if ARCH_POOL_DEBUG
+    std::memset(block.data, FREED_PATTERN, m_BlockSize);
+#endif
+
+    // Pushed back to front so the block is handed out in address order
+    for (size_t i = m_ObjectsPerBlock; i-- > 0;) {
+        FreeHeader* header = reinterpret_cast<FreeHeader*>(block.data + i * m_ObjectSize);
+        header->next = m_FreeList;
+        m_FreeList = header;
+    }
 }
 
 void PoolAllocator::Reset() {
     m_UsedMemory = 0;
     m_NumAllocations = 0;
-    
-    // Calculate actual number of chunks
-    size_t adjustment = 0;
-    uintptr_t currentAddress = (uintptr_t)m_Start;
-    
-    // Align first block
-    size_t multiplier = (currentAddress / m_ObjectAlignment) + 1;
-    // Align first block if necessary (basic implementation assumes Start is aligned)
-    size_t numObjects = m_Size / m_ObjectSize;
-    
     m_FreeList = nullptr;
-    
-    // Initialize free list
-    // Initialize free list
-    
-    uintptr_t p = (uintptr_t)m_Start;
-    for (size_t i = 0; i < numObjects; ++i) {
-        FreeHeader* header = (FreeHeader*)p;
-        header->next = m_FreeList;
-        m_FreeList = header;
-        p += m_ObjectSize;
+
+    // Later blocks are pushed first so allocation starts again at the first block
+    for (size_t i = m_Blocks.size(); i-- > 0;) {
+#if ARCH_POOL_DEBUG
+        m_Blocks[i].live.assign(m_ObjectsPerBlock, false);
+#endif
+        PushBlockSlots(m_Blocks[i]);
     }
 }
 
 void* PoolAllocator::Allocate(size_t size, size_t alignment) {
     // Pool allocator expects fixed size allocations.
-    
-    if (m_FreeList == nullptr) {
-#ifdef _DEBUG
-        std::cerr << "[PoolAllocator] Out of Memory!\n";
-#endif
+    assert(size <= m_ObjectSize && "Allocation larger than the pool's object size");
+    assert(alignment <= m_ObjectAlignment && "Alignment stricter than the pool's alignment");
+    if (size > m_ObjectSize || alignment > m_ObjectAlignment) {
         return nullptr;
     }
-    
+
+    if (m_FreeList == nullptr) {
+        AddBlock();
+    }
+
     void* p = m_FreeList;
     m_FreeList = m_FreeList->next;
-    
+
     m_UsedMemory += m_ObjectSize;
     m_NumAllocations++;
-    
+
+#if ARCH_POOL_DEBUG
+    Block* block = FindBlock(p);
+    block->live[(static_cast<char*>(p) - block->data) / m_ObjectSize] = true;
+    std::memset(p, FRESH_PATTERN, m_ObjectSize);
+#endif
+
     return p;
 }
 
 void PoolAllocator::Free(void* ptr) {
     if (ptr == nullptr) return;
-    
+
+#if ARCH_POOL_DEBUG
+    Block* block = FindBlock(ptr);
+    size_t offset = block ? static_cast<size_t>(static_cast<char*>(ptr) - block->data) : 0;
+    if (!block || offset % m_ObjectSize != 0) {
+        std::cerr << "[PoolAllocator] Free of a pointer that does not belong to the pool: " << ptr << "\n";
+        assert(false && "PoolAllocator: foreign pointer");
+        return;
+    }
+
+    size_t slot = offset / m_ObjectSize;
+    if (!block->live[slot]) {
+        std::cerr << "[PoolAllocator] Double free: " << ptr << "\n";
+        assert(false && "PoolAllocator: double free");
+        return;
+    }
+
+    block->live[slot] = false;
+    std::memset(ptr, FREED_PATTERN, m_ObjectSize);
+#endif
+
     // Push back to free list
-    FreeHeader* header = (FreeHeader*)ptr;
+    FreeHeader* header = static_cast<FreeHeader*>(ptr);
     header->next = m_FreeList;
     m_FreeList = header;
-    
+
     m_UsedMemory -= m_ObjectSize;
     m_NumAllocations--;
 }
 
+bool PoolAllocator::Owns(const void* ptr) const {
+    const char* p = static_cast<const char*>(ptr);
+    for (const Block& block : m_Blocks) {
+        if (p >= block.data && p < block.data + m_BlockSize) {
+            return true;
+        }
+    }
+    return false;
+}
+
+PoolAllocator::Block* PoolAllocator::FindBlock(const void* ptr) {
+    const char* p = static_cast<const char*>(ptr);
+    for (Block& block : m_Blocks) {
+        if (p >= block.data && p < block.data + m_BlockSize) {
+            return &block;
+        }
+    }
+    return nullptr;
+}
+
 } // namespace Archura
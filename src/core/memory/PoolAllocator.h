@@ -1,31 +1,143 @@
 #pragma once
 
 #include "Allocator.h"
+#include "MemoryTracker.h"
+#include <cassert>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Debug poisoning and double-free/foreign-pointer detection (on in debug builds)
+#ifndef ARCH_POOL_DEBUG
+#ifdef _DEBUG
+#define ARCH_POOL_DEBUG 1
+#else
+#define ARCH_POOL_DEBUG 0
+#endif
+#endif
 
 namespace Archura {
 
+class VirtualArena;
+
+/**
+ * @brief PoolAllocator - Fixed-size object pool that grows by whole blocks
+ *
+ * Every slot has the same size and alignment (any power of two, e.g. 16/32/64
+ * for SIMD types). Free slots form an intrusive free list; when it runs dry a
+ * new block of blockSizeBytes is added, so allocation only fails if the system
+ * is out of memory. Blocks are kept until the pool is destroyed.
+ *
+ * With ARCH_POOL_DEBUG, freed and fresh slots are filled with 0xDD / 0xCD and
+ * double frees or pointers that do not belong to the pool are reported.
+ *
+ * Blocks are reported to MemoryTracker under the pool's tag. With a backing
+ * VirtualArena, blocks are carved from it instead (contiguous, committed on
+ * demand, owned and tracked by the arena); the heap is used only if the
+ * arena's reservation runs out.
+ *
+ * Not thread-safe.
+ */
 class PoolAllocator : public Allocator {
 public:
-    PoolAllocator(size_t objectSize, size_t objectAlignment, size_t sizeBytes);
+    PoolAllocator(size_t objectSize, size_t objectAlignment, size_t blockSizeBytes,
+                  MemoryTag tag = MemoryTag::General, VirtualArena* backing = nullptr);
     ~PoolAllocator() override;
 
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+    // size/alignment must not exceed the pool's object size/alignment
     void* Allocate(size_t size, size_t alignment = 8) override;
     void Free(void* ptr) override;
+
+    // Frees every object at once (no destructors run); blocks are kept
     void Reset() override;
 
+    bool Owns(const void* ptr) const;
+
+    size_t GetObjectSize() const { return m_ObjectSize; }
+    size_t GetObjectAlignment() const { return m_ObjectAlignment; }
+    size_t GetAllocationCount() const { return m_NumAllocations; }
+    size_t GetCapacity() const { return m_Blocks.size() * m_ObjectsPerBlock; }
+    size_t GetBlockCount() const { return m_Blocks.size(); }
+    size_t GetUsedMemory() const { return m_UsedMemory; }
+    size_t GetReservedMemory() const { return m_Blocks.size() * m_BlockSize; }
+
+    // Slot size the pool uses for objects of this size/alignment
+    static size_t GetSlotSize(size_t objectSize, size_t objectAlignment);
+
 private:
     struct FreeHeader {
         FreeHeader* next;
     };
 
-    void* m_Start = nullptr;
-    size_t m_ObjectSize;
+    struct Block {
+        char* data;
+        bool fromHeap;
+#if ARCH_POOL_DEBUG
+        std::vector<bool> live;
+#endif
+    };
+
+    void AddBlock();
+    void PushBlockSlots(Block& block);
+    Block* FindBlock(const void* ptr);
+
+    size_t m_ObjectSize;       // Slot size (aligned, fits a FreeHeader)
     size_t m_ObjectAlignment;
-    size_t m_Size;
+    size_t m_ObjectsPerBlock;
+    size_t m_BlockSize;
     size_t m_UsedMemory = 0;
     size_t m_NumAllocations = 0;
+    MemoryTag m_Tag;
+    VirtualArena* m_Backing;
 
+    std::vector<Block> m_Blocks;
     FreeHeader* m_FreeList = nullptr;
 };
 
+/**
+ * @brief TypedPool - PoolAllocator for a single type with construct/destroy
+ *
+ * Objects must be destroyed through Destroy(); objects still alive when the
+ * pool is destroyed are not destructed (asserted in debug builds).
+ */
+template<typename T>
+class TypedPool {
+public:
+    explicit TypedPool(size_t objectsPerBlock = 64, MemoryTag tag = MemoryTag::General)
+        : m_Pool(sizeof(T), alignof(T), PoolAllocator::GetSlotSize(sizeof(T), alignof(T)) * objectsPerBlock, tag)
+    {
+    }
+
+    ~TypedPool() {
+        assert(m_Pool.GetAllocationCount() == 0 && "TypedPool destroyed with live objects");
+    }
+
+    template<typename... Args>
+    T* Create(Args&&... args) {
+        void* memory = m_Pool.Allocate(sizeof(T), alignof(T));
+        try {
+            return new (memory) T(std::forward<Args>(args)...);
+        } catch (...) {
+            m_Pool.Free(memory);
+            throw;
+        }
+    }
+
+    void Destroy(T* object) {
+        if (!object) return;
+        object->~T();
+        m_Pool.Free(object);
+    }
+
+    bool Owns(const T* object) const { return m_Pool.Owns(object); }
+    size_t GetCount() const { return m_Pool.GetAllocationCount(); }
+    PoolAllocator& GetAllocator() { return m_Pool; }
+
+private:
+    PoolAllocator m_Pool;
+};
+
 } // namespace Archura
@@ -23,11 +23,10 @@ void* StackAllocator::Allocate(size_t size, size_t alignment) {
     // Current address
     uintptr_t currentAddress = (uintptr_t)m_Start + m_Offset;
 
-    // Calculate padding for alignment
+    // Calculate padding for alignment (none if already aligned; alignment is a power of two)
     size_t padding = 0;
     if (alignment != 0) {
-        size_t multiplier = (currentAddress / alignment) + 1;
-        uintptr_t alignedAddress = multiplier * alignment;
+        uintptr_t alignedAddress = (currentAddress + alignment - 1) & ~(uintptr_t)(alignment - 1);
         padding = alignedAddress - currentAddress;
     }
 
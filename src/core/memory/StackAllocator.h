@@ -19,6 +19,12 @@ public:
     Marker GetMarker() const;
     void FreeToMarker(Marker marker);
 
+    size_t GetUsed() const { return m_Offset; }
+    size_t GetSize() const { return m_Size; }
+    bool Owns(const void* ptr) const {
+        return ptr >= m_Start && ptr < static_cast<const char*>(m_Start) + m_Size;
+    }
+
 private:
     void* m_Start = nullptr;
     size_t m_Size = 0;
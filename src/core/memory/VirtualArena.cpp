@@ -0,0 +1,142 @@
+#include "VirtualArena.h"
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace Archura {
+
+namespace {
+
+size_t RoundUp(size_t value, size_t granularity) {
+    return (value + granularity - 1) / granularity * granularity;
+}
+
+char* ReserveRange(size_t size) {
+#ifdef _WIN32
+    return static_cast<char*>(VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS));
+#else
+    void* ptr = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    return ptr == MAP_FAILED ? nullptr : static_cast<char*>(ptr);
+#endif
+}
+
+void ReleaseRange(char* base, size_t size) {
+#ifdef _WIN32
+    (void)size;
+    VirtualFree(base, 0, MEM_RELEASE);
+#else
+    munmap(base, size);
+#endif
+}
+
+bool CommitRange(char* start, size_t size) {
+#ifdef _WIN32
+    return VirtualAlloc(start, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+    return mprotect(start, size, PROT_READ | PROT_WRITE) == 0;
+#endif
+}
+
+void DecommitRange(char* start, size_t size) {
+#ifdef _WIN32
+    VirtualFree(start, size, MEM_DECOMMIT);
+#else
+    // Drop the pages first so they stop counting as resident, then fault on access
+    madvise(start, size, MADV_DONTNEED);
+    mprotect(start, size, PROT_NONE);
+#endif
+}
+
+} // namespace
+
+VirtualArena::VirtualArena(size_t reserveBytes, size_t retainBytes, MemoryTag tag)
+    : m_Reserved(RoundUp(std::max<size_t>(reserveBytes, 1), COMMIT_GRANULARITY))
+    , m_RetainBytes(retainBytes)
+    , m_Tag(tag)
+{
+    m_Base = ReserveRange(m_Reserved);
+    if (!m_Base) {
+        std::cerr << "[VirtualArena] Failed to reserve " << m_Reserved / (1024 * 1024) << " MB of address space\n";
+        m_Reserved = 0;
+    }
+}
+
+VirtualArena::~VirtualArena() {
+    if (!m_Base) return;
+    if (m_Committed > 0) {
+        ARCH_TRACK_FREE(m_Base);
+    }
+    ReleaseRange(m_Base, m_Reserved);
+}
+
+void* VirtualArena::Allocate(size_t size, size_t alignment) {
+    uintptr_t current = reinterpret_cast<uintptr_t>(m_Base) + m_Offset;
+    size_t padding = 0;
+    if (alignment != 0) {
+        uintptr_t aligned = (current + alignment - 1) & ~(uintptr_t)(alignment - 1);
+        padding = aligned - current;
+    }
+
+    if (padding + size > m_Reserved - m_Offset) {
+        return nullptr;
+    }
+
+    size_t end = m_Offset + padding + size;
+    if (end > m_Committed && !Commit(end)) {
+        return nullptr;
+    }
+
+    void* ptr = m_Base + m_Offset + padding;
+    m_Offset = end;
+    return ptr;
+}
+
+void VirtualArena::Free(void* ptr) {
+    // Linear arena: memory comes back with FreeToMarker/Reset
+    (void)ptr;
+}
+
+void VirtualArena::Reset() {
+    size_t watermark = std::max(m_RetainBytes, m_Offset);
+    m_Offset = 0;
+    Decommit(RoundUp(watermark, COMMIT_GRANULARITY));
+}
+
+void VirtualArena::FreeToMarker(Marker marker) {
+    assert(marker <= m_Offset && "Marker is above the current arena top");
+    m_Offset = marker;
+}
+
+bool VirtualArena::Commit(size_t end) {
+    size_t target = std::min(RoundUp(end, COMMIT_GRANULARITY), m_Reserved);
+    if (!CommitRange(m_Base + m_Committed, target - m_Committed)) {
+        std::cerr << "[VirtualArena] Failed to commit " << (target - m_Committed) / 1024 << " KB\n";
+        return false;
+    }
+
+    m_Committed = target;
+    ARCH_TRACK_ALLOC(m_Base, m_Committed, m_Tag);
+    return true;
+}
+
+void VirtualArena::Decommit(size_t keep) {
+    if (keep >= m_Committed) return;
+
+    DecommitRange(m_Base + keep, m_Committed - keep);
+    m_Committed = keep;
+    if (m_Committed > 0) {
+        ARCH_TRACK_ALLOC(m_Base, m_Committed, m_Tag);
+    } else {
+        ARCH_TRACK_FREE(m_Base);
+    }
+}
+
+} // namespace Archura
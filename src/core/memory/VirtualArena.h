@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Allocator.h"
+#include "MemoryTracker.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace Archura {
+
+/**
+ * @brief VirtualArena - Linear allocator over a reserved address range, committed on demand
+ *
+ * The constructor only reserves address space (VirtualAlloc MEM_RESERVE /
+ * mmap PROT_NONE); pages are committed in COMMIT_GRANULARITY steps as the
+ * arena grows, so the reservation can be far larger than what is ever used
+ * and resident memory follows actual use. The base address never changes:
+ * growing never moves or invalidates earlier allocations.
+ *
+ * Reset() rewinds the arena and decommits everything above a watermark: the
+ * larger of retainBytes and what was in use at the reset. A steady workload
+ * therefore keeps its pages, while memory from a one-off spike is returned
+ * on the following reset.
+ *
+ * Individual frees are no-ops (use markers or Reset). Not thread-safe.
+ */
+class VirtualArena : public Allocator {
+public:
+    static constexpr size_t COMMIT_GRANULARITY = 64 * 1024;
+
+    explicit VirtualArena(size_t reserveBytes, size_t retainBytes = 0, MemoryTag tag = MemoryTag::General);
+    ~VirtualArena() override;
+
+    VirtualArena(const VirtualArena&) = delete;
+    VirtualArena& operator=(const VirtualArena&) = delete;
+
+    // nullptr when the reservation is exhausted or the OS refuses to commit
+    void* Allocate(size_t size, size_t alignment = 8) override;
+    void Free(void* ptr) override;
+    void Reset() override;
+
+    using Marker = size_t;
+    Marker GetMarker() const { return m_Offset; }
+    void FreeToMarker(Marker marker);
+
+    size_t GetUsed() const { return m_Offset; }
+    size_t GetCommitted() const { return m_Committed; }
+    size_t GetReserved() const { return m_Reserved; }
+    bool IsValid() const { return m_Base != nullptr; }
+    bool Owns(const void* ptr) const {
+        return ptr >= m_Base && ptr < m_Base + m_Reserved;
+    }
+
+private:
+    bool Commit(size_t end);
+    void Decommit(size_t keep);
+
+    char* m_Base = nullptr;
+    size_t m_Reserved = 0;
+    size_t m_Committed = 0;
+    size_t m_Offset = 0;
+    size_t m_RetainBytes;
+    MemoryTag m_Tag;
+};
+
+} // namespace Archura
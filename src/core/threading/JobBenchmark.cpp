@@ -0,0 +1,63 @@
+#include "JobBenchmark.h"
+#include "JobSystem.h"
+#include "../memory/HeapStats.h"
+#include <chrono>
+
+namespace Archura {
+
+namespace {
+
+// Ranges at or below this size submit their empty jobs directly
+constexpr uint32_t LEAF_RANGE = 256;
+
+// Larger than JobRecord::INLINE_SIZE, forces the heap fallback
+struct LargeCapture {
+    uint64_t data[16] = {};
+};
+
+template<bool Large>
+void SubmitRange(uint32_t count, JobCounter* counter) {
+    // Hand the upper halves to other jobs (thieves take the biggest ranges first)
+    while (count > LEAF_RANGE) {
+        uint32_t half = count / 2;
+        JobSystem::Execute([half, counter]() { SubmitRange<Large>(half, counter); }, counter);
+        count -= half;
+    }
+
+    for (uint32_t i = 0; i < count; ++i) {
+        if constexpr (Large) {
+            JobSystem::Execute([capture = LargeCapture()]() { (void)capture; }, counter);
+        } else {
+            JobSystem::Execute([]() {}, counter);
+        }
+    }
+}
+
+} // namespace
+
+JobBenchmarkResult RunJobSystemBenchmark(uint32_t jobCount, bool largeCaptures) {
+    JobBenchmarkResult result;
+    result.workerCount = JobSystem::GetWorkerCount();
+    result.jobCount = jobCount;
+
+    JobCounter counter;
+    uint64_t allocationsBefore = HeapStats::GetAllocationCount();
+    auto begin = std::chrono::steady_clock::now();
+
+    if (largeCaptures) {
+        SubmitRange<true>(jobCount, &counter);
+    } else {
+        SubmitRange<false>(jobCount, &counter);
+    }
+    JobSystem::Wait(counter);
+
+    auto end = std::chrono::steady_clock::now();
+    uint64_t allocations = HeapStats::GetAllocationCount() - allocationsBefore;
+
+    result.seconds = std::chrono::duration<double>(end - begin).count();
+    result.mjobsPerSec = result.seconds > 0.0 ? jobCount / result.seconds / 1e6 : 0.0;
+    result.allocationsPerJob = jobCount > 0 ? static_cast<double>(allocations) / jobCount : 0.0;
+    return result;
+}
+
+} // namespace Archura
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Archura {
+
+struct JobBenchmarkResult {
+    uint32_t workerCount = 0;
+    uint32_t jobCount = 0;
+    double seconds = 0.0;
+    double mjobsPerSec = 0.0;        // Empty jobs completed per second, millions
+    double allocationsPerJob = 0.0;  // Global operator new calls (HeapStats) per job
+};
+
+/**
+ * @brief Throughput of the JobSystem on empty jobs
+ *
+ * The calling thread splits jobCount into ranges recursively (each split is a
+ * job itself) so submission is spread over every worker's deque, as nested
+ * gameplay jobs would, then waits for all of them. Measures scheduling
+ * overhead only: the jobs do no work.
+ *
+ * With largeCaptures every job carries a capture too big for a JobRecord, so
+ * it takes the heap fallback; this is roughly the per-job cost of the old
+ * std::function records and serves as the comparison point.
+ *
+ * Uses the JobSystem as currently initialized; other jobs in flight skew
+ * the result but are not waited for.
+ */
+JobBenchmarkResult RunJobSystemBenchmark(uint32_t jobCount, bool largeCaptures = false);
+
+} // namespace Archura
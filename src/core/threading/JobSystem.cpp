@@ -1,34 +1,206 @@
 #include "JobSystem.h"
+#include "../memory/ConcurrentPoolAllocator.h"
+#include "../memory/VirtualArena.h"
 #include <iostream>
 #include <algorithm> // for std::max
+#include <cassert>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
 
 namespace Archura {
 
+namespace {
+
+// Idle backoff: rounds of spinning (each a full steal sweep), then yielding, then sleeping
+constexpr uint32_t IDLE_SPIN_ROUNDS = 32;
+constexpr uint32_t IDLE_YIELD_ROUNDS = 16;
+constexpr uint32_t PAUSES_PER_SPIN = 32;
+
+constexpr int32_t NO_QUEUE = -1;
+
+// Adaptive grain aims for this many chunks per thread (main thread included)
+constexpr uint32_t CHUNKS_PER_THREAD = 4;
+
+// Per-thread scratch for Dispatch groups / ParallelFor chunks; a stack, so nested loops work.
+// When the outermost scope unwinds, commit above max(retain size, that scope's size) is returned.
+constexpr size_t SCRATCH_RESERVE_SIZE = 64ull * 1024 * 1024;
+constexpr size_t SCRATCH_RETAIN_SIZE = 256 * 1024;
+constexpr size_t SCRATCH_ALIGNMENT = 64;
+
+// Deque owned by this thread (index into s_Queues), NO_QUEUE for other threads
+thread_local int32_t t_QueueIndex = NO_QUEUE;
+thread_local uint32_t t_RandomState = 0;
+
+inline void CpuRelax() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#else
+    std::this_thread::yield();
+#endif
+}
+
+// Spins, then yields; false once the caller should go to sleep
+bool IdleBackoff(uint32_t& idleRounds) {
+    ++idleRounds;
+    if (idleRounds <= IDLE_SPIN_ROUNDS) {
+        for (uint32_t i = 0; i < PAUSES_PER_SPIN; ++i) {
+            CpuRelax();
+        }
+        return true;
+    }
+    if (idleRounds <= IDLE_SPIN_ROUNDS + IDLE_YIELD_ROUNDS) {
+        std::this_thread::yield();
+        return true;
+    }
+    return false;
+}
+
+// xorshift32; victim selection only needs to be cheap and differ per thread
+inline uint32_t NextRandom() {
+    uint32_t x = t_RandomState;
+    if (x == 0) {
+        x = static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1u;
+    }
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    t_RandomState = x;
+    return x;
+}
+
+VirtualArena& GetScratchArena() {
+    thread_local std::unique_ptr<VirtualArena> arena;
+    if (!arena) {
+        arena = std::make_unique<VirtualArena>(SCRATCH_RESERVE_SIZE, SCRATCH_RETAIN_SIZE);
+    }
+    return *arena;
+}
+
+// Scratch block released when the group finishes
+class ScratchScope {
+public:
+    explicit ScratchScope(size_t size) {
+        if (size == 0) return;
+        VirtualArena& arena = GetScratchArena();
+        m_Marker = arena.GetMarker();
+        m_Memory = arena.Allocate(size, SCRATCH_ALIGNMENT);
+        m_Arena = &arena;
+    }
+
+    ~ScratchScope() {
+        if (!m_Arena) return;
+        if (m_Marker == 0) {
+            // Outermost scope: Reset keeps what this group used (steady loops keep
+            // their pages) and decommits a one-off spike from nested scopes or larger groups
+            m_Arena->Reset();
+        } else {
+            m_Arena->FreeToMarker(m_Marker);
+        }
+    }
+
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope& operator=(const ScratchScope&) = delete;
+
+    void* Get() const { return m_Memory; }
+
+private:
+    VirtualArena* m_Arena = nullptr;
+    VirtualArena::Marker m_Marker = 0;
+    void* m_Memory = nullptr;
+};
+
+// Records are usually freed by another thread than the one that allocated
+// them (thieves); the pool's per-thread magazines absorb that without locks
+ConcurrentPoolAllocator& GetRecordPool() {
+    static ConcurrentPoolAllocator pool(sizeof(JobRecord), alignof(JobRecord));
+    return pool;
+}
+
+} // namespace
+
+JobCounter::~JobCounter() {
+    assert(IsDone() && !m_Continuations && "JobCounter destroyed while jobs still reference it");
+}
+
+void JobCounter::Add(uint32_t count) {
+    m_Value.fetch_add(count, std::memory_order_acq_rel);
+}
+
+void JobCounter::Decrement() {
+    // Not the last one: a single atomic op, the counter is not touched afterwards
+    uint32_t value = m_Value.load(std::memory_order_relaxed);
+    while (value > 1) {
+        if (m_Value.compare_exchange_weak(value, value - 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+
+    // Possibly the last one: decrement under the lock so ExecuteAfter cannot
+    // add a continuation between reaching zero and releasing the list, and so
+    // Wait(counter) can tell when this thread is done with the counter
+    JobRecord* released = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        uint32_t previous = m_Value.fetch_sub(1, std::memory_order_acq_rel);
+        assert(previous > 0 && "JobCounter decremented below zero");
+        if (previous != 1) return;
+
+        released = m_Continuations;
+        m_Continuations = nullptr;
+    }
+
+    JobSystem::OnCounterDone(released);
+}
+
 std::vector<std::thread> JobSystem::s_WorkerThreads;
-std::deque<JobSystem::Job> JobSystem::s_JobQueue;
+std::vector<std::unique_ptr<JobSystem::JobQueue>> JobSystem::s_Queues;
+std::deque<JobRecord*> JobSystem::s_JobQueue;
 std::mutex JobSystem::s_QueueMutex;
+std::atomic<uint32_t> JobSystem::s_InjectedJobs = 0;
+std::mutex JobSystem::s_SleepMutex;
 std::condition_variable JobSystem::s_Condition;
+std::atomic<uint32_t> JobSystem::s_SleepingWorkers = 0;
+std::atomic<uint32_t> JobSystem::s_SleepingWaiters = 0;
+std::atomic<int32_t> JobSystem::s_QueuedJobs = 0;
 std::atomic<bool> JobSystem::s_Running = false;
+std::atomic<bool> JobSystem::s_MainThreadParticipation = true;
 std::atomic<uint32_t> JobSystem::s_ActiveJobs = 0;
 
-void JobSystem::Init() {
-    uint32_t numCores = std::thread::hardware_concurrency();
-    uint32_t numWorkers = std::max(1u, numCores - 1);
+void JobSystem::Init(uint32_t workerCount) {
+    uint32_t numWorkers = workerCount;
+    if (numWorkers == 0) {
+        uint32_t numCores = std::thread::hardware_concurrency();
+        numWorkers = std::max(1u, numCores > 0 ? numCores - 1 : 1u);
+    }
 
     s_Running = true;
 
+    // All deques exist before any worker starts, so s_Queues is never resized while stealing
+    s_Queues.clear();
+    for (uint32_t i = 0; i <= numWorkers; ++i) {
+        s_Queues.push_back(std::make_unique<JobQueue>());
+    }
+    t_QueueIndex = 0;
+
     for (uint32_t i = 0; i < numWorkers; ++i) {
-        s_WorkerThreads.emplace_back(WorkerThread);
+        s_WorkerThreads.emplace_back(WorkerThread, i + 1);
     }
-    
+
 #ifdef _DEBUG
     std::cout << "[JobSystem] Initialized with " << numWorkers << " worker threads.\n";
 #endif
 }
 
 void JobSystem::Shutdown() {
-    s_Running = false;
-    
+    {
+        std::lock_guard<std::mutex> lock(s_SleepMutex);
+        s_Running = false;
+    }
+
     // Wake up all threads
     s_Condition.notify_all();
 
@@ -37,70 +209,267 @@ void JobSystem::Shutdown() {
             thread.join();
         }
     }
-    
+
     s_WorkerThreads.clear();
+
+    // Anything submitted after the workers drained runs here
+    while (RunPendingJob(t_QueueIndex)) {
+    }
+
+    s_Queues.clear();
+    t_QueueIndex = NO_QUEUE;
 }
 
-void JobSystem::Execute(const JobSystem::Job& job) {
+JobRecord* JobSystem::AllocateRecord(JobCounter* counter) {
     s_ActiveJobs++;
-    
+    if (counter) {
+        counter->Add(1);
+    }
+
+    JobRecord* record = static_cast<JobRecord*>(GetRecordPool().Allocate(sizeof(JobRecord), alignof(JobRecord)));
+    record->counter = counter;
+    record->next = nullptr;
+    return record;
+}
+
+void JobSystem::SubmitAfter(JobCounter& dependency, JobRecord* record) {
     {
+        std::lock_guard<std::mutex> lock(dependency.m_Mutex);
+        if (dependency.m_Value.load(std::memory_order_acquire) > 0) {
+            record->next = dependency.m_Continuations;
+            dependency.m_Continuations = record;
+            return;
+        }
+    }
+
+    Submit(record);
+}
+
+void JobSystem::Submit(JobRecord* record) {
+    s_QueuedJobs++;
+
+    int32_t queueIndex = t_QueueIndex;
+    if (queueIndex == NO_QUEUE || static_cast<size_t>(queueIndex) >= s_Queues.size()
+        || !s_Queues[queueIndex]->Push(record)) {
         std::lock_guard<std::mutex> lock(s_QueueMutex);
-        s_JobQueue.push_back(job);
+        s_JobQueue.push_back(record);
+        s_InjectedJobs++;
+    }
+
+    // s_QueuedJobs is raised before this check and a sleeper re-checks it under
+    // s_SleepMutex, so the wakeup cannot be lost
+    if (s_SleepingWorkers > 0) {
+        std::lock_guard<std::mutex> lock(s_SleepMutex);
+        s_Condition.notify_one();
     }
-    
-    s_Condition.notify_one();
 }
 
-void JobSystem::Dispatch(uint32_t jobCount, uint32_t groupSize, const std::function<void(JobSystem::JobDispatchArgs)>& job) {
-    if (jobCount == 0 || groupSize == 0) return;
+void JobSystem::OnCounterDone(JobRecord* continuations) {
+    while (continuations) {
+        JobRecord* next = continuations->next;
+        continuations->next = nullptr;
+        Submit(continuations);
+        continuations = next;
+    }
 
-    // TODO: Implement proper chunking for caching efficiency
-    // Currently dispatching 1 job per index for simplicity
-    
-    for (uint32_t i = 0; i < jobCount; ++i) {
-         // Copy args by value to lambda
-        Execute([i, job]() {
-            JobSystem::JobDispatchArgs args;
-            args.jobIndex = i;
-            args.groupIndex = 0;
-            job(args);
-        });
+    // Sleeping Wait(counter) callers re-check their counters; the counter
+    // reached zero before this load, so a waiter going to sleep sees it
+    if (s_SleepingWaiters > 0) {
+        std::lock_guard<std::mutex> lock(s_SleepMutex);
+        s_Condition.notify_all();
     }
 }
 
+void JobSystem::RunDispatchGroup(uint32_t jobCount, uint32_t groupSize, uint32_t groupID, size_t sharedMemorySize,
+                                 const Callback<JobDispatchArgs>& func) {
+    ScratchScope scratch(sharedMemorySize);
+
+    JobSystem::JobDispatchArgs args;
+    args.groupID = groupID;
+    args.sharedMemory = scratch.Get();
+
+    uint32_t first = groupID * groupSize;
+    uint32_t last = static_cast<uint32_t>(std::min<uint64_t>(jobCount, static_cast<uint64_t>(first) + groupSize));
+    for (uint32_t i = first; i < last; ++i) {
+        args.jobIndex = i;
+        args.groupIndex = i - first;
+        func(args);
+    }
+}
+
+void JobSystem::RunParallelFor(uint32_t begin, uint32_t end, uint32_t grain, const Callback<const ParallelRange&>& func,
+                               size_t scratchSize) {
+    if (begin >= end) return;
+
+    uint32_t count = end - begin;
+    if (grain == 0) {
+        grain = GetAdaptiveGrain(count);
+    }
+    uint32_t chunkCount = static_cast<uint32_t>((static_cast<uint64_t>(count) + grain - 1) / grain);
+
+    if (chunkCount == 1 || GetWorkerCount() == 0) {
+        for (uint32_t chunk = 0; chunk < chunkCount; ++chunk) {
+            RunParallelChunk(func, begin, end, grain, chunk, scratchSize);
+        }
+        return;
+    }
+
+    // Chunks copy the callback (two pointers); the callable it points to lives
+    // in the caller's frame, which Wait keeps alive until they finish
+    JobCounter counter;
+    for (uint32_t chunk = 1; chunk < chunkCount; ++chunk) {
+        Execute([func, begin, end, grain, chunk, scratchSize]() {
+            RunParallelChunk(func, begin, end, grain, chunk, scratchSize);
+        }, &counter);
+    }
+
+    RunParallelChunk(func, begin, end, grain, 0, scratchSize);
+    Wait(counter);
+}
+
+uint32_t JobSystem::GetAdaptiveGrain(uint32_t count) {
+    uint32_t chunks = (GetWorkerCount() + 1) * CHUNKS_PER_THREAD;
+    return std::max(1u, static_cast<uint32_t>((static_cast<uint64_t>(count) + chunks - 1) / chunks));
+}
+
+void JobSystem::RunParallelChunk(const Callback<const ParallelRange&>& func, uint32_t begin, uint32_t end,
+                                 uint32_t grain, uint32_t chunk, size_t scratchSize) {
+    ScratchScope scratch(scratchSize);
+
+    ParallelRange range;
+    range.begin = begin + chunk * grain;
+    range.end = static_cast<uint32_t>(std::min<uint64_t>(end, static_cast<uint64_t>(range.begin) + grain));
+    range.groupID = chunk;
+    range.scratch = scratch.Get();
+    func(range);
+}
+
 bool JobSystem::IsBusy() {
     return s_ActiveJobs > 0;
 }
 
 void JobSystem::Wait() {
     while (IsBusy()) {
+        if (s_MainThreadParticipation && RunPendingJob(t_QueueIndex)) {
+            continue;
+        }
         std::this_thread::yield();
     }
 }
 
-void JobSystem::WorkerThread() {
-    while (s_Running) {
-        JobSystem::Job job;
-        {
-            std::unique_lock<std::mutex> lock(s_QueueMutex);
-            s_Condition.wait(lock, []() { return !s_JobQueue.empty() || !s_Running; });
-            
-            if (!s_Running && s_JobQueue.empty()) {
-                return;
-            }
-            
-                continue;
-            
+void JobSystem::Wait(JobCounter& counter) {
+    // Always helps, even with main thread participation off: the jobs being
+    // waited on may sit in this thread's own deque
+    uint32_t idleRounds = 0;
+    while (!counter.IsDone()) {
+        if (RunPendingJob(t_QueueIndex)) {
+            idleRounds = 0;
+            continue;
+        }
+        if (IdleBackoff(idleRounds)) {
+            continue;
+        }
+
+        SleepUntilWork(&counter);
+        idleRounds = 0;
+    }
+
+    // The final Decrement may still hold the lock; after this the caller may destroy the counter
+    std::lock_guard<std::mutex> lock(counter.m_Mutex);
+}
+
+bool JobSystem::RunPendingJob(int32_t queueIndex) {
+    JobRecord* job = nullptr;
+
+    if (queueIndex != NO_QUEUE && static_cast<size_t>(queueIndex) < s_Queues.size()) {
+        job = s_Queues[queueIndex]->Pop();
+    }
+    if (!job) {
+        job = StealJob(queueIndex);
+    }
+    if (!job && s_InjectedJobs.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(s_QueueMutex);
+        if (!s_JobQueue.empty()) {
             job = s_JobQueue.front();
             s_JobQueue.pop_front();
+            s_InjectedJobs--;
+        }
+    }
+    if (!job) {
+        return false;
+    }
+
+    s_QueuedJobs--;
+
+    // Execute Job
+    job->execute(job->payload);
+    JobCounter* counter = job->counter;
+    GetRecordPool().Free(job);
+
+    // May release continuations; they are already counted in s_ActiveJobs
+    if (counter) {
+        counter->Decrement();
+    }
+
+    s_ActiveJobs--;
+    return true;
+}
+
+JobRecord* JobSystem::StealJob(int32_t queueIndex) {
+    uint32_t queueCount = static_cast<uint32_t>(s_Queues.size());
+    if (queueCount == 0) return nullptr;
+
+    // Random starting victim spreads thieves out instead of all hitting deque 0
+    uint32_t start = NextRandom() % queueCount;
+    for (uint32_t i = 0; i < queueCount; ++i) {
+        uint32_t victim = (start + i) % queueCount;
+        if (static_cast<int32_t>(victim) == queueIndex) continue;
+
+        if (JobRecord* job = s_Queues[victim]->Steal()) {
+            return job;
         }
-        
-        // Execute Job
-        job();
-        
-        s_ActiveJobs--;
     }
+    return nullptr;
+}
+
+void JobSystem::WorkerThread(uint32_t queueIndex) {
+    t_QueueIndex = static_cast<int32_t>(queueIndex);
+    t_RandomState = queueIndex * 0x9E3779B9u + 1u;
+
+    uint32_t idleRounds = 0;
+    while (s_Running) {
+        if (RunPendingJob(t_QueueIndex)) {
+            idleRounds = 0;
+            continue;
+        }
+
+        if (IdleBackoff(idleRounds)) {
+            continue;
+        }
+
+        SleepUntilWork(nullptr);
+        idleRounds = 0;
+    }
+
+    // Drain before exiting so Shutdown never drops submitted jobs
+    while (RunPendingJob(t_QueueIndex)) {
+    }
+}
+
+void JobSystem::SleepUntilWork(const JobCounter* counter) {
+    std::unique_lock<std::mutex> lock(s_SleepMutex);
+
+    // Waiters count as sleeping workers too: a new job must be able to wake
+    // them, or jobs queued behind sleeping waiters could never run
+    s_SleepingWorkers++;
+    if (counter) s_SleepingWaiters++;
+
+    s_Condition.wait(lock, [counter]() {
+        return s_QueuedJobs > 0 || !s_Running || (counter && counter->IsDone());
+    });
+
+    if (counter) s_SleepingWaiters--;
+    s_SleepingWorkers--;
 }
 
 } // namespace Archura
@@ -1,43 +1,267 @@
 #pragma once
 
+#include "WorkStealingDeque.h"
 #include <functional>
 #include <vector>
 #include <thread>
 #include <atomic>
+#include <memory>
 #include <mutex>
 #include <condition_variable>
+#include <cstddef>
 #include <deque>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace Archura {
 
+class JobCounter;
+
+/**
+ * @brief JobRecord - Fixed-size job: entry point plus inline capture storage
+ *
+ * Callables up to INLINE_SIZE bytes are constructed inside the record;
+ * larger ones are copied to the heap and the payload holds the pointer.
+ * Records come from a pool that recycles them per thread, so submitting a
+ * small lambda does not touch the heap.
+ */
+struct alignas(64) JobRecord {
+    static constexpr size_t INLINE_SIZE = 96;
+    static constexpr size_t INLINE_ALIGNMENT = 16;
+
+    void (*execute)(void* payload);  // Runs the callable, then destroys it
+    JobCounter* counter;             // Lowered when the job finishes, may be null
+    JobRecord* next;                 // Link in a counter's continuation list
+    alignas(INLINE_ALIGNMENT) unsigned char payload[INLINE_SIZE];
+};
+
+static_assert(sizeof(JobRecord) == 128, "JobRecord should stay two cache lines");
+
+/**
+ * @brief JobCounter - Completion counter for a group of jobs
+ *
+ * Jobs submitted with a counter raise it when submitted and lower it when
+ * they finish. JobSystem::Wait(counter) returns once it reaches zero, and
+ * JobSystem::ExecuteAfter(counter, job) queues a job for that moment. Add and
+ * Decrement let code outside jobs (or a job graph) drive a counter by hand.
+ *
+ * Must outlive the jobs that reference it; reusable once it is back at zero.
+ */
+class JobCounter {
+public:
+    JobCounter() = default;
+    ~JobCounter();
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    void Add(uint32_t count = 1);
+    // Reaching zero releases the jobs queued with ExecuteAfter
+    void Decrement();
+
+    uint32_t GetValue() const { return m_Value.load(std::memory_order_acquire); }
+    bool IsDone() const { return GetValue() == 0; }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<uint32_t> m_Value{0};
+    std::mutex m_Mutex;                    // Guards m_Continuations and the final decrement
+    JobRecord* m_Continuations = nullptr;  // Intrusive list of ExecuteAfter jobs
+};
+
+/**
+ * @brief JobSystem - Work-stealing thread pool
+ *
+ * Every worker owns a Chase-Lev deque; the thread that called Init() (the
+ * main thread) owns one more. Jobs submitted from a worker or the main thread
+ * go to that thread's own deque without locking. Idle workers pop their own
+ * deque first, then steal from randomly chosen victims, then check a locked
+ * injection queue used by other threads and by full deques.
+ *
+ * Workers with nothing to do spin briefly, then yield, then sleep on a
+ * condition variable until new work is submitted.
+ *
+ * Completion is tracked per group with JobCounter. Wait(counter) runs
+ * pending jobs on the calling thread while it waits and sleeps once there is
+ * nothing left to run, so it is safe (and cheap) inside jobs. The global
+ * Wait() waits for every job in the system; with main thread participation
+ * on (default) it also runs queued jobs instead of just yielding.
+ *
+ * Parallel loops: Dispatch runs jobCount jobs in groups of groupSize (one job
+ * per group); ParallelFor splits an index range into chunks and blocks until
+ * every chunk has run. Both can hand each group a scratch block from a
+ * per-thread arena, valid only while that group runs.
+ */
 class JobSystem {
 public:
     using Job = std::function<void()>;
 
     // Utility struct for parallel loops
     struct JobDispatchArgs {
-        uint32_t jobIndex;
-        uint32_t groupIndex;
+        uint32_t jobIndex;     // 0..jobCount-1
+        uint32_t groupID;      // Group (and job) this index runs in
+        uint32_t groupIndex;   // Position inside the group, 0..groupSize-1
+        void* sharedMemory;    // Scratch shared by the group, nullptr if none was requested
+    };
+
+    // One chunk of a ParallelFor range
+    struct ParallelRange {
+        uint32_t begin;
+        uint32_t end;          // Exclusive
+        uint32_t groupID;      // Chunk number, in range order
+        void* scratch;         // Private to this chunk, nullptr if none was requested
     };
 
-    static void Init();
+    // workerCount 0 = one worker per core, minus the main thread
+    static void Init(uint32_t workerCount = 0);
     static void Shutdown();
 
-    static void Execute(const Job& job);
-    static void Dispatch(uint32_t jobCount, uint32_t groupSize, const std::function<void(JobDispatchArgs)>& job);
-    
+    // func is any void() callable (a Job works too). Captures up to
+    // JobRecord::INLINE_SIZE bytes are stored in the record without allocating.
+    // counter (optional) is raised now and lowered when the job finishes.
+    template<typename Func>
+    static void Execute(Func&& func, JobCounter* counter = nullptr) {
+        Submit(CreateRecord(std::forward<Func>(func), counter));
+    }
+
+    // Queued once dependency reaches zero (right away if it already has)
+    template<typename Func>
+    static void ExecuteAfter(JobCounter& dependency, Func&& func, JobCounter* counter = nullptr) {
+        SubmitAfter(dependency, CreateRecord(std::forward<Func>(func), counter));
+    }
+
+    // func: void(JobDispatchArgs), copied into every group's job.
+    // Asynchronous like Execute: wait on counter (or Wait()) for completion.
+    template<typename Func>
+    static void Dispatch(uint32_t jobCount, uint32_t groupSize, Func&& func,
+                         size_t groupSharedMemorySize = 0, JobCounter* counter = nullptr) {
+        if (jobCount == 0 || groupSize == 0) return;
+
+        using Callable = std::decay_t<Func>;
+        uint32_t groupCount = static_cast<uint32_t>((static_cast<uint64_t>(jobCount) + groupSize - 1) / groupSize);
+        for (uint32_t groupID = 0; groupID < groupCount; ++groupID) {
+            Execute([func = Callable(func), jobCount, groupSize, groupID, groupSharedMemorySize]() mutable {
+                RunDispatchGroup(jobCount, groupSize, groupID, groupSharedMemorySize, MakeCallback<JobDispatchArgs>(func));
+            }, counter);
+        }
+    }
+
+    // Splits [begin, end) into chunks of grain indices (0 = adaptive) and returns
+    // once all of them ran. The caller runs the first chunk and then helps with
+    // other jobs, so it is safe to call from inside a job. func: void(const ParallelRange&)
+    template<typename Func>
+    static void ParallelFor(uint32_t begin, uint32_t end, uint32_t grain, Func&& func, size_t scratchSize = 0) {
+        // func outlives every chunk (ParallelFor blocks), so chunks only need its address
+        RunParallelFor(begin, end, grain, MakeCallback<const ParallelRange&>(func), scratchSize);
+    }
+
+    // Grain giving a few chunks per thread, so uneven chunks still balance
+    static uint32_t GetAdaptiveGrain(uint32_t count);
+
     static bool IsBusy();
+    // Waits for every job in the system; prefer Wait(counter)
     static void Wait();
+    // Runs pending jobs until counter reaches zero, sleeping when none are left to run
+    static void Wait(JobCounter& counter);
+
+    static void SetMainThreadParticipation(bool enabled) { s_MainThreadParticipation = enabled; }
+    static bool IsMainThreadParticipating() { return s_MainThreadParticipation; }
+
+    // Zero until Init() has been called
+    static uint32_t GetWorkerCount() { return static_cast<uint32_t>(s_WorkerThreads.size()); }
 
 private:
-    static void WorkerThread();
+    friend class JobCounter;
+
+    using JobQueue = WorkStealingDeque<JobRecord>;
+
+    // Non-owning reference to a callable, so loop bodies need no std::function
+    template<typename Arg>
+    struct Callback {
+        void* context;
+        void (*call)(void* context, Arg arg);
+
+        void operator()(Arg arg) const { call(context, arg); }
+    };
+
+    template<typename Arg, typename Func>
+    static Callback<Arg> MakeCallback(Func& func) {
+        using Target = std::remove_reference_t<Func>;
+        return Callback<Arg>{
+            const_cast<void*>(static_cast<const void*>(std::addressof(func))),
+            [](void* context, Arg arg) { (*static_cast<Target*>(context))(arg); }
+        };
+    }
+
+    static void WorkerThread(uint32_t queueIndex);
+
+    // Takes a pooled record; raises the active job count and the counter
+    static JobRecord* AllocateRecord(JobCounter* counter);
+
+    template<typename Func>
+    static JobRecord* CreateRecord(Func&& func, JobCounter* counter) {
+        using Callable = std::decay_t<Func>;
+        JobRecord* record = AllocateRecord(counter);
+
+        if constexpr (sizeof(Callable) <= JobRecord::INLINE_SIZE && alignof(Callable) <= JobRecord::INLINE_ALIGNMENT) {
+            new (record->payload) Callable(std::forward<Func>(func));
+            record->execute = [](void* payload) {
+                Callable* callable = static_cast<Callable*>(payload);
+                (*callable)();
+                callable->~Callable();
+            };
+        } else {
+            // Too big for the record: type-erased heap copy
+            new (record->payload) Callable*(new Callable(std::forward<Func>(func)));
+            record->execute = [](void* payload) {
+                Callable* callable = *static_cast<Callable**>(payload);
+                (*callable)();
+                delete callable;
+            };
+        }
+        return record;
+    }
+
+    // Makes the record runnable (now, or once dependency reaches zero)
+    static void Submit(JobRecord* record);
+    static void SubmitAfter(JobCounter& dependency, JobRecord* record);
+    // Called by the final JobCounter::Decrement with its released continuations
+    static void OnCounterDone(JobRecord* continuations);
+
+    // Pops, steals or takes an injected job and runs it; false if none was found
+    static bool RunPendingJob(int32_t queueIndex);
+    static JobRecord* StealJob(int32_t queueIndex);
+
+    // Blocks until a job is queued (or counter, if given, reaches zero)
+    static void SleepUntilWork(const JobCounter* counter);
+
+    static void RunDispatchGroup(uint32_t jobCount, uint32_t groupSize, uint32_t groupID, size_t sharedMemorySize,
+                                 const Callback<JobDispatchArgs>& func);
+    static void RunParallelFor(uint32_t begin, uint32_t end, uint32_t grain, const Callback<const ParallelRange&>& func,
+                               size_t scratchSize);
+    static void RunParallelChunk(const Callback<const ParallelRange&>& func, uint32_t begin, uint32_t end,
+                                 uint32_t grain, uint32_t chunk, size_t scratchSize);
 
     // shared state
     static std::vector<std::thread> s_WorkerThreads;
-    static std::deque<Job> s_JobQueue;
+    static std::vector<std::unique_ptr<JobQueue>> s_Queues;  // [0] = main thread, [1..] = workers
+
+    // Injection queue: jobs from threads without a deque, or from a full deque
+    static std::deque<JobRecord*> s_JobQueue;
     static std::mutex s_QueueMutex;
+    static std::atomic<uint32_t> s_InjectedJobs;
+
+    // Idle workers sleep here once spinning found nothing
+    static std::mutex s_SleepMutex;
     static std::condition_variable s_Condition;
+    static std::atomic<uint32_t> s_SleepingWorkers;  // Includes sleeping Wait(counter) callers
+    static std::atomic<uint32_t> s_SleepingWaiters;  // Wait(counter) callers only
+    static std::atomic<int32_t> s_QueuedJobs;  // Submitted but not yet picked up
+
     static std::atomic<bool> s_Running;
+    static std::atomic<bool> s_MainThreadParticipation;
     static std::atomic<uint32_t> s_ActiveJobs; // Tracks jobs currently running + in queue
 };
 
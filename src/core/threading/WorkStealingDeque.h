@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace Archura {
+
+/**
+ * @brief WorkStealingDeque - Fixed-capacity Chase-Lev deque of pointers
+ *
+ * The owning thread pushes and pops at the bottom (LIFO, cache-warm); any
+ * other thread steals from the top (FIFO, oldest work first). Push/Pop are
+ * wait-free for the owner except when racing a thief for the last element;
+ * Steal is lock-free and may fail spuriously under contention.
+ *
+ * Capacity is fixed (power of two); Push returns false when full so the
+ * caller can fall back to another queue.
+ */
+template<typename T, uint32_t Capacity = 4096>
+class WorkStealingDeque {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    WorkStealingDeque() {
+        for (auto& slot : m_Buffer) {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Owner only
+    bool Push(T* item) {
+        int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+        int64_t top = m_Top.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<int64_t>(Capacity)) {
+            return false;
+        }
+
+        m_Buffer[bottom & MASK].store(item, std::memory_order_relaxed);
+        m_Bottom.store(bottom + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Owner only
+    T* Pop() {
+        int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+        m_Bottom.store(bottom, std::memory_order_seq_cst);
+        int64_t top = m_Top.load(std::memory_order_seq_cst);
+
+        if (top > bottom) {
+            // Empty
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T* item = m_Buffer[bottom & MASK].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // Last element: race thieves for it
+            if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    // Any thread
+    T* Steal() {
+        int64_t top = m_Top.load(std::memory_order_seq_cst);
+        int64_t bottom = m_Bottom.load(std::memory_order_seq_cst);
+        if (top >= bottom) {
+            return nullptr;
+        }
+
+        T* item = m_Buffer[top & MASK].load(std::memory_order_relaxed);
+        if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;  // Lost to the owner or another thief
+        }
+        return item;
+    }
+
+    // Approximate (racy) size, for heuristics only
+    int64_t GetSize() const {
+        return m_Bottom.load(std::memory_order_relaxed) - m_Top.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr int64_t MASK = static_cast<int64_t>(Capacity) - 1;
+
+    alignas(64) std::atomic<int64_t> m_Top{0};
+    alignas(64) std::atomic<int64_t> m_Bottom{0};
+    alignas(64) std::atomic<T*> m_Buffer[Capacity];
+};
+
+} // namespace Archura
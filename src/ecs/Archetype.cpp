@@ -0,0 +1,198 @@
+#include "Archetype.h"
+#include "../core/memory/PoolAllocator.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+
+namespace Archura {
+
+namespace {
+
+size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Verilen kapasite icin kolon ofsetlerini hesaplar ve toplam chunk boyutunu dondurur
+size_t ComputeLayout(const std::vector<const ComponentInfo*>& signature, uint32_t capacity, std::vector<size_t>& outOffsets) {
+    outOffsets.clear();
+    size_t offset = sizeof(Entity*) * capacity;
+    for (const ComponentInfo* info : signature) {
+        offset = AlignUp(offset, info->alignment);
+        outOffsets.push_back(offset);
+        offset += info->size * capacity;
+    }
+    return offset;
+}
+
+std::atomic<ComponentTypeID> s_TypeCount{0};
+
+} // namespace
+
+ComponentTypeID ComponentInfo::NextTypeID() {
+    ComponentTypeID id = s_TypeCount++;
+    // Release'te de durdurulur: maske/kolon tablolari MAX_COMPONENTS boyutunda
+    if (id >= MAX_COMPONENTS) {
+        std::cerr << "Fatal: more than MAX_COMPONENTS (" << MAX_COMPONENTS << ") component types registered\n";
+        std::abort();
+    }
+    return id;
+}
+
+size_t ComponentInfo::GetTypeCount() {
+    return s_TypeCount.load();
+}
+
+const char* ComponentInfo::ShortName(const char* name) {
+    // Namespace ve "struct "/"class " on ekleri atlanir
+    const char* result = name;
+    for (const char* c = name; *c; ++c) {
+        if (*c == ' ' || *c == ':') {
+            result = c + 1;
+        }
+    }
+    return result;
+}
+
+Archetype::Archetype(std::vector<const ComponentInfo*> signature, PoolAllocator* chunkPool)
+    : m_Signature(std::move(signature))
+{
+    m_ColumnLookup.fill(-1);
+    for (size_t col = 0; col < m_Signature.size(); ++col) {
+        m_Mask.set(m_Signature[col]->id);
+        m_ColumnLookup[m_Signature[col]->id] = static_cast<int8_t>(col);
+    }
+
+    m_RowBytes = sizeof(Entity*);
+    for (const ComponentInfo* info : m_Signature) {
+        m_RowBytes += info->size;
+    }
+
+    m_ChunkCapacity = static_cast<uint32_t>(std::max<size_t>(1, CHUNK_SIZE / m_RowBytes));
+    size_t layoutBytes = ComputeLayout(m_Signature, m_ChunkCapacity, m_ColumnOffsets);
+    while (m_ChunkCapacity > 1 && layoutBytes > CHUNK_SIZE) {
+        --m_ChunkCapacity;
+        layoutBytes = ComputeLayout(m_Signature, m_ChunkCapacity, m_ColumnOffsets);
+    }
+
+    // Tek satiri bile CHUNK_SIZE'a sigmayan buyuk component'ler icin chunk buyutulur
+    m_ChunkBytes = AlignUp(std::max(layoutBytes, CHUNK_SIZE), CHUNK_ALIGNMENT);
+
+    if (chunkPool && m_ChunkBytes <= chunkPool->GetObjectSize() && CHUNK_ALIGNMENT <= chunkPool->GetObjectAlignment()) {
+        m_ChunkPool = chunkPool;
+    }
+}
+
+Archetype::~Archetype() {
+    for (uint32_t row = 0; row < m_Count; ++row) {
+        for (size_t col = 0; col < m_Signature.size(); ++col) {
+            m_Signature[col]->destroy(GetComponent(row, static_cast<int>(col)));
+        }
+    }
+
+    for (std::byte* chunk : m_Chunks) {
+        FreeChunk(chunk);
+    }
+}
+
+uint32_t Archetype::GetChunkEntityCount(size_t chunk) const {
+    size_t first = chunk * m_ChunkCapacity;
+    if (first >= m_Count) return 0;
+    return static_cast<uint32_t>(std::min<size_t>(m_ChunkCapacity, m_Count - first));
+}
+
+uint32_t Archetype::AllocateRow(Entity* entity) {
+    uint32_t row = m_Count;
+    size_t chunk = row / m_ChunkCapacity;
+
+    if (chunk >= m_Chunks.size()) {
+        AllocateChunk();
+    }
+
+    GetEntities(chunk)[row % m_ChunkCapacity] = entity;
+    ++m_Count;
+    return row;
+}
+
+void Archetype::Reserve(uint32_t count) {
+    size_t needed = (static_cast<size_t>(m_Count) + count + m_ChunkCapacity - 1) / m_ChunkCapacity;
+    m_Chunks.reserve(needed);
+    while (m_Chunks.size() < needed) {
+        AllocateChunk();
+    }
+}
+
+void Archetype::AllocateChunk() {
+    void* chunk = m_ChunkPool
+        ? m_ChunkPool->Allocate(m_ChunkBytes, CHUNK_ALIGNMENT)
+        : ::operator new(m_ChunkBytes, std::align_val_t(CHUNK_ALIGNMENT));
+    if (!m_ChunkPool) {
+        ARCH_TRACK_ALLOC(chunk, m_ChunkBytes, MemoryTag::ECS);
+    }
+    m_Chunks.push_back(static_cast<std::byte*>(chunk));
+    ++m_ChunkAllocations;
+}
+
+void Archetype::FreeChunk(std::byte* chunk) {
+    if (m_ChunkPool) {
+        m_ChunkPool->Free(chunk);
+    } else {
+        ::operator delete(chunk, std::align_val_t(CHUNK_ALIGNMENT));
+    }
+}
+
+Entity* Archetype::RemoveRow(uint32_t row) {
+    for (size_t col = 0; col < m_Signature.size(); ++col) {
+        m_Signature[col]->destroy(GetComponent(row, static_cast<int>(col)));
+    }
+    return FillHole(row);
+}
+
+uint32_t Archetype::MoveRow(uint32_t row, Archetype& dst, Entity** outMoved) {
+    uint32_t newRow = dst.AllocateRow(GetEntity(row));
+
+    for (size_t col = 0; col < m_Signature.size(); ++col) {
+        void* src = GetComponent(row, static_cast<int>(col));
+        int dstCol = dst.GetColumn(m_Signature[col]);
+        if (dstCol >= 0) {
+            m_Signature[col]->moveConstruct(dst.GetComponent(newRow, dstCol), src);
+        }
+        m_Signature[col]->destroy(src);
+    }
+
+    Entity* moved = FillHole(row);
+    if (outMoved) *outMoved = moved;
+    return newRow;
+}
+
+Entity* Archetype::FillHole(uint32_t row) {
+    uint32_t last = m_Count - 1;
+    Entity* moved = nullptr;
+
+    if (row != last) {
+        // Son satiri bosluga tasi (swap-remove), boylece diziler yogun kalir
+        for (size_t col = 0; col < m_Signature.size(); ++col) {
+            void* src = GetComponent(last, static_cast<int>(col));
+            m_Signature[col]->moveConstruct(GetComponent(row, static_cast<int>(col)), src);
+            m_Signature[col]->destroy(src);
+        }
+        moved = GetEntity(last);
+        GetEntities(row / m_ChunkCapacity)[row % m_ChunkCapacity] = moved;
+    }
+
+    --m_Count;
+    ReleaseSpareChunks();
+    return moved;
+}
+
+void Archetype::ReleaseSpareChunks() {
+    // Sinirda surekli ayir/birak yapmamak icin bir bos chunk yedekte tutulur
+    size_t used = GetChunkCount();
+    while (m_Chunks.size() > used + 1) {
+        FreeChunk(m_Chunks.back());
+        m_Chunks.pop_back();
+        ++m_ChunkReleases;
+    }
+}
+
+} // namespace Archura
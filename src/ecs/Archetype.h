@@ -0,0 +1,172 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace Archura {
+
+class Entity;
+class PoolAllocator;
+
+// Yogun component tip ID'leri (0..MAX_COMPONENTS-1) ve bunlarin bit maskesi
+using ComponentTypeID = uint32_t;
+constexpr size_t MAX_COMPONENTS = 64;
+using ComponentMask = std::bitset<MAX_COMPONENTS>;
+
+/**
+ * @brief ComponentInfo - Bir component tipinin tip-silinmis (type-erased) tanimi
+ *
+ * Archetype'lar component'leri ham bellekte tutar; tasima ve yok etme
+ * islemleri bu fonksiyon isaretcileri uzerinden yapilir.
+ *
+ * Her tip ilk kullanimda kucuk bir ID alir (typeid/hash yok); varlik kontrolu
+ * maskede bit testi, kolon bulma ise dizi indekslemedir. name sadece
+ * profiler/editor gosterimi icindir.
+ */
+struct ComponentInfo {
+    ComponentTypeID id;
+    const char* name;
+    size_t size;
+    size_t alignment;
+    bool trivial;  // Trivially copyable: kopyalama memcpy ile yapilabilir
+    void (*copyConstruct)(void* dst, const void* src);
+    void (*moveConstruct)(void* dst, void* src);
+    void (*destroy)(void* ptr);
+
+    template<typename T>
+    static const ComponentInfo* Get() {
+        static const ComponentInfo info{
+            NextTypeID(), ShortName(typeid(T).name()), sizeof(T), alignof(T), std::is_trivially_copyable_v<T>,
+            [](void* dst, const void* src) { new (dst) T(*static_cast<const T*>(src)); },
+            [](void* dst, void* src) { new (dst) T(std::move(*static_cast<T*>(src))); },
+            [](void* ptr) { static_cast<T*>(ptr)->~T(); }
+        };
+        return &info;
+    }
+
+    // Kayitli component tipi sayisi
+    static size_t GetTypeCount();
+
+private:
+    static ComponentTypeID NextTypeID();
+
+    // "struct Archura::Transform" -> "Transform"
+    static const char* ShortName(const char* name);
+};
+
+/**
+ * @brief Archetype - Ayni component kumesine sahip entity'lerin deposu
+ *
+ * Entity'ler sabit boyutlu chunk'larda SoA (Structure of Arrays) duzeninde
+ * tutulur: her chunk icinde her component tipi icin ardisik bir dizi vardir.
+ * Satirlar her zaman yogundur (dense); silme islemi son satiri bosluga tasir.
+ * Chunk'lar yer degistirmez, bu yuzden ekleme mevcut satirlari gecersiz kilmaz.
+ */
+class Archetype {
+public:
+    static constexpr size_t CHUNK_SIZE = 16 * 1024;
+    static constexpr size_t CHUNK_ALIGNMENT = 64;
+
+    // chunkPool verilirse standart boyuttaki chunk'lar oradan alinir (Scene'in havuzu)
+    explicit Archetype(std::vector<const ComponentInfo*> signature, PoolAllocator* chunkPool = nullptr);
+    ~Archetype();
+
+    Archetype(const Archetype&) = delete;
+    Archetype& operator=(const Archetype&) = delete;
+
+    const std::vector<const ComponentInfo*>& GetSignature() const { return m_Signature; }
+    const ComponentMask& GetMask() const { return m_Mask; }
+
+    // Component'in kolon indeksi, yoksa -1
+    int GetColumn(const ComponentInfo* info) const { return m_ColumnLookup[info->id]; }
+    bool Has(const ComponentInfo* info) const { return m_Mask.test(info->id); }
+
+    uint32_t GetEntityCount() const { return m_Count; }
+    uint32_t GetChunkCapacity() const { return m_ChunkCapacity; }
+    size_t GetChunkCount() const { return (m_Count + m_ChunkCapacity - 1) / m_ChunkCapacity; }
+    uint32_t GetChunkEntityCount(size_t chunk) const;
+
+    // Bellek istatistikleri: ayrilmis chunk'lar (yedek dahil), satir basina byte (Entity* dahil)
+    size_t GetAllocatedChunkCount() const { return m_Chunks.size(); }
+    size_t GetChunkBytes() const { return m_ChunkBytes; }
+    size_t GetRowSize() const { return m_RowBytes; }
+
+    // Baslangictan beri chunk ayirma/birakma sayilari (frame basina fark profiler'da alinir)
+    uint64_t GetChunkAllocations() const { return m_ChunkAllocations; }
+    uint64_t GetChunkReleases() const { return m_ChunkReleases; }
+
+    void* GetColumnData(size_t chunk, int column) const {
+        return m_Chunks[chunk] + m_ColumnOffsets[column];
+    }
+
+    template<typename T>
+    T* GetColumnData(size_t chunk, int column) const {
+        return static_cast<T*>(GetColumnData(chunk, column));
+    }
+
+    Entity** GetEntities(size_t chunk) const {
+        return reinterpret_cast<Entity**>(m_Chunks[chunk]);
+    }
+
+    void* GetComponent(uint32_t row, int column) const {
+        return m_Chunks[row / m_ChunkCapacity] + m_ColumnOffsets[column]
+            + (row % m_ChunkCapacity) * m_Signature[column]->size;
+    }
+
+    Entity* GetEntity(uint32_t row) const {
+        return GetEntities(row / m_ChunkCapacity)[row % m_ChunkCapacity];
+    }
+
+    // Yeni bir satir ayirir; component'ler construct EDILMEZ
+    uint32_t AllocateRow(Entity* entity);
+
+    // count yeni satir icin gereken chunk'lari tek seferde ayirir
+    void Reserve(uint32_t count);
+
+    // Satirdaki component'leri yok eder ve boslugu son satirla kapatir.
+    // Yeri degisen entity'i dondurur (yoksa nullptr).
+    Entity* RemoveRow(uint32_t row);
+
+    // Satiri dst'ye tasir: ortak component'ler move edilir, digerleri yok edilir.
+    // dst'de eksik kalan kolonlar construct edilmemis olarak birakilir.
+    uint32_t MoveRow(uint32_t row, Archetype& dst, Entity** outMoved);
+
+    // Tek component ekleme/cikarma gecisleri icin onbellek
+    Archetype* GetAddEdge(const ComponentInfo* info) const { return m_AddEdges[info->id]; }
+    Archetype* GetRemoveEdge(const ComponentInfo* info) const { return m_RemoveEdges[info->id]; }
+    void SetAddEdge(const ComponentInfo* info, Archetype* target) { m_AddEdges[info->id] = target; }
+    void SetRemoveEdge(const ComponentInfo* info, Archetype* target) { m_RemoveEdges[info->id] = target; }
+
+private:
+    Entity* FillHole(uint32_t row);
+    void AllocateChunk();
+    void FreeChunk(std::byte* chunk);
+    void ReleaseSpareChunks();
+
+    std::vector<const ComponentInfo*> m_Signature;
+    ComponentMask m_Mask;
+    std::array<int8_t, MAX_COMPONENTS> m_ColumnLookup;  // Tip ID -> kolon, yoksa -1
+    std::vector<size_t> m_ColumnOffsets;   // Chunk basindan itibaren kolon ofsetleri
+    uint32_t m_ChunkCapacity = 1;
+    size_t m_ChunkBytes = CHUNK_SIZE;
+    size_t m_RowBytes = 0;
+
+    std::vector<std::byte*> m_Chunks;
+    PoolAllocator* m_ChunkPool = nullptr;  // Buyuk (CHUNK_SIZE'i asan) chunk'larda nullptr
+    uint32_t m_Count = 0;
+    uint64_t m_ChunkAllocations = 0;
+    uint64_t m_ChunkReleases = 0;
+
+    std::array<Archetype*, MAX_COMPONENTS> m_AddEdges{};
+    std::array<Archetype*, MAX_COMPONENTS> m_RemoveEdges{};
+};
+
+} // namespace Archura
@@ -0,0 +1,236 @@
+#include "CommandBuffer.h"
+#include "Entity.h"
+#include "Prefab.h"
+#include "../core/memory/FrameAllocator.h"
+#include "../core/memory/MemoryTracker.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Archura {
+
+namespace {
+
+constexpr size_t PAYLOAD_ALIGNMENT = 64;
+
+size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+CommandBuffer::~CommandBuffer() {
+    DestroyPayloads();
+    for (PayloadBlock& block : m_Blocks) {
+        ::operator delete(block.data, std::align_val_t(PAYLOAD_ALIGNMENT));
+    }
+}
+
+EntityID CommandBuffer::CreateEntity(StringID name) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    // Ertelenmis ID: nesil 0, indeks 1'den baslar (0 NullEntity olurdu)
+    EntityID deferred = MakeEntityID(++m_DeferredCount, 0);
+
+    Command command{};
+    command.type = Command::Type::Create;
+    command.entity = deferred;
+    command.nameIndex = static_cast<uint32_t>(m_Names.size());
+    m_Names.push_back(name);
+    m_Commands.push_back(command);
+    return deferred;
+}
+
+EntityID CommandBuffer::Instantiate(const Prefab& prefab, uint32_t count, const Transform* transforms) {
+    if (count == 0) return NullEntity;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    EntityID first = MakeEntityID(m_DeferredCount + 1, 0);
+    m_DeferredCount += count;
+
+    Command command{};
+    command.type = Command::Type::Instantiate;
+    command.entity = first;
+    command.prefab = &prefab;
+    command.count = count;
+    if (transforms) {
+        // Transform trivially copyable; blokta ham kopya yeterli
+        command.payload = AllocatePayload(sizeof(Transform) * count, alignof(Transform));
+        std::memcpy(command.payload, transforms, sizeof(Transform) * count);
+    }
+    m_Commands.push_back(command);
+    return first;
+}
+
+void CommandBuffer::DestroyEntity(EntityID id) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    Record(Command::Type::Destroy, id, nullptr, nullptr);
+}
+
+void CommandBuffer::Record(Command::Type type, EntityID id, const ComponentInfo* info, void* payload) {
+    Command command{};
+    command.type = type;
+    command.entity = id;
+    command.info = info;
+    command.payload = payload;
+    m_Commands.push_back(command);
+}
+
+void* CommandBuffer::AllocatePayload(size_t size, size_t alignment) {
+    // Mevcut blokta yer yoksa sonrakine gec; bloklar Clear()'da tekrar kullanilir
+    while (m_CurrentBlock < m_Blocks.size()) {
+        PayloadBlock& block = m_Blocks[m_CurrentBlock];
+        size_t offset = AlignUp(block.used, alignment);
+        if (offset + size <= block.size) {
+            block.used = offset + size;
+            return block.data + offset;
+        }
+        ++m_CurrentBlock;
+    }
+
+    size_t blockSize = std::max(PAYLOAD_BLOCK_SIZE, AlignUp(size, PAYLOAD_ALIGNMENT));
+    PayloadBlock block;
+    block.data = static_cast<std::byte*>(::operator new(blockSize, std::align_val_t(PAYLOAD_ALIGNMENT)));
+    ARCH_TRACK_ALLOC(block.data, blockSize, MemoryTag::ECS);
+    block.size = blockSize;
+    block.used = size;
+    m_Blocks.push_back(block);
+    m_CurrentBlock = m_Blocks.size() - 1;
+    return block.data;
+}
+
+void CommandBuffer::DestroyPayloads() {
+    for (Command& command : m_Commands) {
+        if (command.type == Command::Type::Add && command.payload) {
+            command.info->destroy(command.payload);
+            command.payload = nullptr;
+        }
+    }
+}
+
+void CommandBuffer::Clear() {
+    DestroyPayloads();
+    m_Commands.clear();
+    m_Names.clear();
+    for (PayloadBlock& block : m_Blocks) {
+        block.used = 0;
+    }
+    m_CurrentBlock = 0;
+    m_DeferredCount = 0;
+}
+
+void CommandBuffer::Playback(Scene& scene) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_Commands.empty()) return;
+
+    // Gecici diziler frame arenasinda: oynatma heap ayirmasi yapmaz
+    // 1. Olusturmalar (kayit sirasiyla) ve ertelenmis ID'lerin cozumlenmesi
+    FrameVector<EntityID> created(m_DeferredCount + 1, NullEntity);
+    for (const Command& command : m_Commands) {
+        if (command.type == Command::Type::Create) {
+            Entity* entity = scene.CreateEntity(m_Names[command.nameIndex]);
+            created[GetEntityIndex(command.entity)] = entity->GetID();
+        } else if (command.type == Command::Type::Instantiate) {
+            // Ertelenmis indeksler ardisik: gercek ID'ler dogrudan tabloya yazilir
+            scene.Instantiate(*command.prefab, command.count,
+                static_cast<const Transform*>(command.payload), &created[GetEntityIndex(command.entity)]);
+        }
+    }
+
+    FrameVector<Command*> changes;
+    FrameVector<Command*> destroys;
+    changes.reserve(m_Commands.size());
+    for (Command& command : m_Commands) {
+        if (IsDeferred(command.entity)) {
+            command.entity = created[GetEntityIndex(command.entity)];
+        }
+
+        if (command.type == Command::Type::Add || command.type == Command::Type::Remove) {
+            changes.push_back(&command);
+        } else if (command.type == Command::Type::Destroy) {
+            destroys.push_back(&command);
+        }
+    }
+
+    // 2. Component degisiklikleri: entity'e gore grupla (kayit sirasi korunur; komutlar
+    // m_Commands'ta ardisik oldugundan adres sirasi kayit sirasidir)
+    std::sort(changes.begin(), changes.end(), [](const Command* a, const Command* b) {
+        return a->entity != b->entity ? a->entity < b->entity : a < b;
+    });
+
+    FrameVector<const ComponentInfo*> signature;
+    FrameVector<Command*> pendingAdds;
+
+    for (size_t begin = 0; begin < changes.size();) {
+        size_t end = begin;
+        while (end < changes.size() && changes[end]->entity == changes[begin]->entity) {
+            ++end;
+        }
+
+        Entity* entity = scene.GetEntity(changes[begin]->entity);
+        if (!entity) {
+            // Silinmis/gecersiz entity: payload'lar Clear()'da yok edilir
+            begin = end;
+            continue;
+        }
+
+        Archetype* source = entity->m_Archetype;
+        signature.assign(source->GetSignature().begin(), source->GetSignature().end());
+        ComponentMask mask = source->GetMask();
+        pendingAdds.clear();
+
+        // Komutlari sirayla uygulayarak son component kumesini hesapla
+        for (size_t i = begin; i < end; ++i) {
+            Command* command = changes[i];
+            auto pending = std::find_if(pendingAdds.begin(), pendingAdds.end(),
+                [command](const Command* c) { return c->info == command->info; });
+
+            if (pending != pendingAdds.end()) {
+                // Ayni component icin onceki kayit gecersiz kaldi
+                (*pending)->info->destroy((*pending)->payload);
+                (*pending)->payload = nullptr;
+                pendingAdds.erase(pending);
+            }
+
+            bool inSignature = mask.test(command->info->id);
+            if (command->type == Command::Type::Add) {
+                pendingAdds.push_back(command);
+                if (!inSignature) {
+                    signature.push_back(command->info);
+                    mask.set(command->info->id);
+                }
+            } else if (inSignature) {
+                signature.erase(std::remove(signature.begin(), signature.end(), command->info), signature.end());
+                mask.reset(command->info->id);
+            }
+        }
+
+        // Tek archetype gecisi, ardindan yeni degerlerin yerlestirilmesi
+        Archetype* target = scene.FindArchetype(mask);
+        if (!target) {
+            target = scene.GetOrCreateArchetype(std::vector<const ComponentInfo*>(signature.begin(), signature.end()));
+        }
+        scene.MoveEntity(entity, target);
+
+        for (Command* command : pendingAdds) {
+            void* dst = target->GetComponent(entity->m_Row, target->GetColumn(command->info));
+            if (source->Has(command->info)) {
+                command->info->destroy(dst); // Mevcut deger yenisiyle degistirilir
+            }
+            command->info->moveConstruct(dst, command->payload);
+            command->info->destroy(command->payload);
+            command->payload = nullptr;
+        }
+
+        begin = end;
+    }
+
+    // 3. Silmeler
+    for (const Command* command : destroys) {
+        scene.DestroyEntity(command->entity);
+    }
+
+    Clear();
+}
+
+} // namespace Archura
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "Archetype.h"
+#include "EntityID.h"
+#include "../core/StringID.h"
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Archura {
+
+class Scene;
+class Prefab;
+struct Transform;
+
+/**
+ * @brief CommandBuffer - Ertelenmis yapisal degisiklikler (create/destroy/add/remove)
+ *
+ * Sistemler iterasyon sirasinda (JobSystem worker thread'lerinden de) buraya
+ * kayit yapar; Scene bu kayitlari bir senkronizasyon noktasinda tek seferde
+ * uygular. Boylece iterasyon sirasinda archetype'lar degismez.
+ *
+ * Oynatma sirasi: once olusturmalar, sonra entity'e gore gruplanmis component
+ * degisiklikleri (entity basina tek archetype gecisi), en son silmeler.
+ *
+ * Not: Kuyruktaki AddComponent, component zaten varsa degerini degistirir.
+ */
+class CommandBuffer {
+public:
+    CommandBuffer() = default;
+    ~CommandBuffer();
+
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+    // Ertelenmis bir ID dondurur; ayni buffer'daki Add/Remove/Destroy'da kullanilabilir
+    EntityID CreateEntity(StringID name = "Entity");
+    void DestroyEntity(EntityID id);
+
+    // Scene::Instantiate'in ertelenmis hali. Ilk ertelenmis ID'yi dondurur; ID'ler
+    // ardisiktir (first + i). Prefab oynatmaya kadar yasamali; transforms kopyalanir.
+    EntityID Instantiate(const Prefab& prefab, uint32_t count, const Transform* transforms = nullptr);
+
+    template<typename T, typename... Args>
+    void AddComponent(EntityID id, Args&&... args) {
+        const ComponentInfo* info = ComponentInfo::Get<T>();
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        void* payload = AllocatePayload(info);
+        new (payload) T(std::forward<Args>(args)...);
+        Record(Command::Type::Add, id, info, payload);
+    }
+
+    template<typename T>
+    void RemoveComponent(EntityID id) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        Record(Command::Type::Remove, id, ComponentInfo::Get<T>(), nullptr);
+    }
+
+    bool IsEmpty() const { return m_Commands.empty(); }
+    size_t GetCommandCount() const { return m_Commands.size(); }
+
+    // Sadece ana thread'den, iterasyon disinda cagrilmali
+    void Playback(Scene& scene);
+
+    // Ertelenmis ID'ler nesil 0 tasir; Scene'de hicbir zaman gecerli degildir
+    static bool IsDeferred(EntityID id) {
+        return id != NullEntity && GetEntityGeneration(id) == 0;
+    }
+
+private:
+    struct Command {
+        enum class Type : uint8_t { Create, Instantiate, Destroy, Add, Remove };
+
+        Type type;
+        EntityID entity;
+        union {
+            const ComponentInfo* info;  // Add/Remove
+            const Prefab* prefab;       // Instantiate
+        };
+        void* payload;           // Add: construct edilmis component, Instantiate: Transform dizisi
+        union {
+            uint32_t nameIndex;  // Create: m_Names indeksi
+            uint32_t count;      // Instantiate: entity sayisi
+        };
+    };
+
+    struct PayloadBlock {
+        std::byte* data;
+        size_t size;
+        size_t used;
+    };
+
+    static constexpr size_t PAYLOAD_BLOCK_SIZE = 16 * 1024;
+
+    void Record(Command::Type type, EntityID id, const ComponentInfo* info, void* payload);
+    void* AllocatePayload(const ComponentInfo* info) { return AllocatePayload(info->size, info->alignment); }
+    void* AllocatePayload(size_t size, size_t alignment);
+    void DestroyPayloads();
+    void Clear();
+
+    std::mutex m_Mutex;
+    std::vector<Command> m_Commands;
+    std::vector<StringID> m_Names;
+    std::vector<PayloadBlock> m_Blocks;  // Payload'lar yer degistirmez
+    size_t m_CurrentBlock = 0;
+    uint32_t m_DeferredCount = 0;
+};
+
+} // namespace Archura
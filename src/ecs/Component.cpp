@@ -1,23 +1,123 @@
 #include "Component.h"
-#include <glm/gtc/matrix_transform.hpp>
+#include <cmath>
 
 namespace Archura {
 
+namespace {
+
+// Rz * Ry * Rx (derece); glm::rotate zincirinin trigonometri tekrari olmayan hali
+glm::mat3 EulerToMatrix(const glm::vec3& degrees) {
+    glm::vec3 r = glm::radians(degrees);
+    float sx = std::sin(r.x), cx = std::cos(r.x);
+    float sy = std::sin(r.y), cy = std::cos(r.y);
+    float sz = std::sin(r.z), cz = std::cos(r.z);
+
+    return glm::mat3(
+        glm::vec3(cz * cy, sz * cy, -sy),
+        glm::vec3(cz * sy * sx - sz * cx, sz * sy * sx + cz * cx, cy * sx),
+        glm::vec3(cz * sy * cx + sz * sx, sz * sy * cx - cz * sx, cy * cx));
+}
+
+glm::mat4 ComposeModel(const glm::vec3& position, const glm::mat3& rotation, const glm::vec3& scale) {
+    return glm::mat4(
+        glm::vec4(rotation[0] * scale.x, 0.0f),
+        glm::vec4(rotation[1] * scale.y, 0.0f),
+        glm::vec4(rotation[2] * scale.z, 0.0f),
+        glm::vec4(position, 1.0f));
+}
+
+// (T * R * S)^-1 = S^-1 * R^T * T^-1; genel 4x4 ters alma gerekmez
+glm::mat4 ComposeInverseModel(const glm::vec3& position, const glm::mat3& rotation, const glm::vec3& scale) {
+    glm::vec3 invScale(
+        scale.x != 0.0f ? 1.0f / scale.x : 0.0f,
+        scale.y != 0.0f ? 1.0f / scale.y : 0.0f,
+        scale.z != 0.0f ? 1.0f / scale.z : 0.0f);
+
+    glm::mat4 inverse(1.0f);
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            inverse[j][i] = rotation[i][j] * invScale[i];
+        }
+        inverse[3][i] = -glm::dot(rotation[i], position) * invScale[i];
+    }
+    return inverse;
+}
+
+} // namespace
+
 glm::mat4 Transform::GetModelMatrix() const {
-    glm::mat4 model = glm::mat4(1.0f);
-    
-    // Otele
-    model = glm::translate(model, position);
-    
-    // Dondur (ZYX sirasi)
-    model = glm::rotate(model, glm::radians(rotation.z), glm::vec3(0, 0, 1));
-    model = glm::rotate(model, glm::radians(rotation.y), glm::vec3(0, 1, 0));
-    model = glm::rotate(model, glm::radians(rotation.x), glm::vec3(1, 0, 0));
-    
-    // Olcekle
-    model = glm::scale(model, scale);
-    
+    if (m_HasParent || !IsDirty()) {
+        return m_ModelMatrix;
+    }
+    return ComposeModel(position, EulerToMatrix(rotation), scale);
+}
+
+glm::mat4 Transform::GetInverseModelMatrix() const {
+    if (m_HasParent || !IsDirty()) {
+        return m_InverseModelMatrix;
+    }
+    return ComposeInverseModel(position, EulerToMatrix(rotation), scale);
+}
+
+glm::mat4 Transform::GetRigidMatrix() const {
+    // Kolonlar normalize edilerek olcek atilir (parent olcegi dahil)
+    glm::mat4 model = GetModelMatrix();
+    for (int i = 0; i < 3; ++i) {
+        float length = glm::length(glm::vec3(model[i]));
+        model[i] = length > 0.0f ? model[i] / length : glm::vec4(0.0f);
+    }
     return model;
 }
 
+glm::mat4 Transform::GetInverseRigidMatrix() const {
+    // (T * R)^-1 = R^T * T^-1
+    glm::mat4 rigid = GetRigidMatrix();
+    glm::mat3 rotationT = glm::transpose(glm::mat3(rigid));
+    glm::mat4 inverse(rotationT);
+    inverse[3] = glm::vec4(-(rotationT * glm::vec3(rigid[3])), 1.0f);
+    return inverse;
+}
+
+bool Transform::UpdateMatrices() {
+    if (!IsDirty()) {
+        return false;
+    }
+
+    glm::mat3 rotationMatrix = EulerToMatrix(rotation);
+    m_ModelMatrix = ComposeModel(position, rotationMatrix, scale);
+    m_InverseModelMatrix = ComposeInverseModel(position, rotationMatrix, scale);
+
+    m_CachedPosition = position;
+    m_CachedRotation = rotation;
+    m_CachedScale = scale;
+    m_Dirty = false;
+    return true;
+}
+
+bool Transform::UpdateLocalMatrix(glm::mat4& outLocal) {
+    if (!IsDirty()) {
+        return false;
+    }
+
+    outLocal = ComposeModel(position, EulerToMatrix(rotation), scale);
+    m_CachedPosition = position;
+    m_CachedRotation = rotation;
+    m_CachedScale = scale;
+    m_Dirty = false;
+    return true;
+}
+
+void Transform::SetWorldMatrix(const glm::mat4& world) {
+    // Afin ters: 3x3 kisim tersi ve ters cevrilmis oteleme
+    glm::mat3 inverseLinear = glm::inverse(glm::mat3(world));
+    m_ModelMatrix = world;
+    m_InverseModelMatrix = glm::mat4(inverseLinear);
+    m_InverseModelMatrix[3] = glm::vec4(-(inverseLinear * glm::vec3(world[3])), 1.0f);
+}
+
+void Transform::MarkDirty() {
+    // Acik bayrak: NaN karsilastirmasi -ffast-math altinda guvenilir degil
+    m_Dirty = true;
+}
+
 } // namespace Archura
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "EntityID.h"
 #include <cstdint>
 #include <vector>
 #include <memory>
@@ -16,20 +17,72 @@ class System;
 
 /**
  * @brief Component base class - Tüm component'ler bundan türer
+ *
+ * Component'ler archetype chunk'larinda deger olarak tutulur; sanal yikici
+ * (ve vtable isaretcisi) gerekmez.
  */
 struct Component {
-    virtual ~Component() = default;
 };
 
 /**
  * @brief Transform component - Pozisyon, rotasyon, scale
+ *
+ * Model (dunya) matrisi ve tersi onbellekte tutulur. Alanlar dogrudan
+ * yazilabilir; onbellek son hesaplandigi TRS degerleriyle karsilastirilarak
+ * kirli (dirty) kabul edilir. TransformSystem her frame kirli olanlari yeniden
+ * hesaplar, degismeyen (statik) nesneler icin matris hesabi yapilmaz.
+ *
+ * Parent'i olan Transform'da TRS parent'in uzayinda (yerel) tanimlidir; dunya
+ * matrisi sadece TransformSystem'de hesaplanir, arada bir frame eski kalabilir.
  */
 struct Transform : public Component {
     glm::vec3 position = glm::vec3(0.0f);
     glm::vec3 rotation = glm::vec3(0.0f); // Euler angles (degrees)
     glm::vec3 scale = glm::vec3(1.0f);
 
+    // Dunya matrisi: kok icin T * Rz * Ry * Rx * S; onbellek kirliyse o an hesaplanir
     glm::mat4 GetModelMatrix() const;
+    glm::mat4 GetInverseModelMatrix() const;
+
+    // Olceksiz (T * R) matris ve tersi - carpisma testleri icin
+    glm::mat4 GetRigidMatrix() const;
+    glm::mat4 GetInverseRigidMatrix() const;
+
+    bool IsDirty() const {
+        return m_Dirty || position != m_CachedPosition || rotation != m_CachedRotation || scale != m_CachedScale;
+    }
+
+    bool HasParent() const { return m_HasParent; }
+
+    // Kok Transform icin: kirliyse onbellegi yeniler; yeniden hesaplandiysa true
+    bool UpdateMatrices();
+
+private:
+    friend class Scene;
+    friend class TransformSystem;
+
+    // Child icin: kirliyse yerel matrisi hesaplar ve TRS'i onbellege alir
+    bool UpdateLocalMatrix(glm::mat4& outLocal);
+    void SetWorldMatrix(const glm::mat4& world);
+    void MarkDirty();
+
+    glm::vec3 m_CachedPosition = glm::vec3(0.0f);
+    glm::vec3 m_CachedRotation = glm::vec3(0.0f);
+    glm::vec3 m_CachedScale = glm::vec3(1.0f);
+    glm::mat4 m_ModelMatrix = glm::mat4(1.0f);
+    glm::mat4 m_InverseModelMatrix = glm::mat4(1.0f);
+    bool m_HasParent = false;
+    bool m_Dirty = false; // MarkDirty: TRS degismese de onbellek yeniden hesaplanir
+};
+
+/**
+ * @brief Parent component - Transform hiyerarsisinde ust entity
+ *
+ * Scene::SetParent ile atanmalidir (dogrudan degistirilirse TransformSystem
+ * hiyerarsiyi yeniden kurmaz). Parent silinirse child'lar da silinir.
+ */
+struct Parent : public Component {
+    EntityID entity = NullEntity;
 };
 
 /**
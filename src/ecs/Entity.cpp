@@ -1,43 +1,432 @@
 #include "Entity.h"
+#include "Prefab.h"
 #include <algorithm>
+#include <cstring>
+#include <atomic>
 
 namespace Archura {
 
-Entity::Entity(EntityID id, const std::string& name)
-    : m_ID(id), m_Name(name)
+Entity::Entity(Scene* scene, EntityID id, StringID name)
+    : m_Scene(scene), m_ID(id), m_Name(name)
 {
-    // Her varlik otomatik olarak Donusum bilesenine sahip
-    AddComponent<Transform>();
+    // Archetype satiri ve isim indeksi Scene tarafindan atanir (CreateEntity/Instantiate)
+}
+
+void Entity::SetName(StringID name) {
+    if (name == m_Name) return;
+
+    m_Scene->RemoveFromNameIndex(this);
+    m_Name = name;
+    m_Scene->AddToNameIndex(this);
 }
 
 // ==================== Scene ====================
 
 Scene::Scene(const std::string& name)
     : m_Name(name)
+    , m_ChunkArena(CHUNK_ARENA_RESERVE, 0, MemoryTag::ECS)
+    , m_ChunkPool(Archetype::CHUNK_SIZE, Archetype::CHUNK_ALIGNMENT, Archetype::CHUNK_SIZE * CHUNKS_PER_POOL_BLOCK, MemoryTag::ECS, &m_ChunkArena)
 {
+    m_RootArchetype = GetOrCreateArchetype({});
+
+    // Her varlik otomatik olarak Donusum bilesenine sahip
+    m_TransformArchetype = GetArchetypeWith(m_RootArchetype, ComponentInfo::Get<Transform>());
+}
+
+Scene::~Scene() {
+    // Sayfalar ham bellek: canli Entity'ler elle yok edilir (component'leri archetype'lar yok eder)
+    for (EntitySlot& slot : m_Slots) {
+        if (slot.entity) {
+            slot.entity->~Entity();
+        }
+    }
+}
+
+uint32_t Scene::AcquireSlot() {
+    // Once bosalmis slotlari tekrar kullan
+    if (!m_FreeSlots.empty()) {
+        uint32_t index = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+        return index;
+    }
+
+    uint32_t index = static_cast<uint32_t>(m_Slots.size());
+    m_Slots.emplace_back();
+    if (index / ENTITY_PAGE_SIZE >= m_EntityPages.size()) {
+        m_EntityPages.push_back(std::make_unique<EntityPage>());
+    }
+    return index;
 }
 
-Entity* Scene::CreateEntity(const std::string& name) {
-    auto entity = std::make_shared<Entity>(m_NextEntityID++, name);
+Entity* Scene::ConstructEntity(uint32_t index, StringID name, Archetype* archetype) {
+    EntitySlot& slot = m_Slots[index];
+    void* memory = m_EntityPages[index / ENTITY_PAGE_SIZE]->storage + sizeof(Entity) * (index % ENTITY_PAGE_SIZE);
+    slot.entity = new (memory) Entity(this, MakeEntityID(index, slot.generation), name);
+
+    Entity* entity = slot.entity;
+    entity->m_Archetype = archetype;
+    entity->m_Row = archetype->AllocateRow(entity);
+    entity->m_DenseIndex = static_cast<uint32_t>(m_Entities.size());
     m_Entities.push_back(entity);
-    return entity.get();
+    AddToNameIndex(entity);
+
+    ++m_FrameCounters.entitiesCreated;
+    CountComponents(archetype->GetMask(), m_FrameCounters.added, 1);
+    return entity;
+}
+
+Entity* Scene::CreateEntity(StringID name) {
+    Entity* entity = ConstructEntity(AcquireSlot(), name, m_TransformArchetype);
+    new (m_TransformArchetype->GetComponent(entity->m_Row, 0)) Transform();
+    return entity;
+}
+
+void Scene::Instantiate(const Prefab& prefab, uint32_t count, const Transform* transforms, EntityID* outIDs) {
+    if (count == 0) return;
+
+    Archetype* archetype = FindArchetype(prefab.m_Mask);
+    if (!archetype) {
+        archetype = GetOrCreateArchetype(prefab.m_Signature);
+    }
+
+    // Tum satirlar ve entity kayitlari tek seferde ayrilir
+    archetype->Reserve(count);
+    m_Entities.reserve(m_Entities.size() + count);
+    m_Slots.reserve(m_Slots.size() + count);
+
+    uint32_t firstRow = archetype->GetEntityCount();
+    for (uint32_t i = 0; i < count; ++i) {
+        Entity* entity = ConstructEntity(AcquireSlot(), prefab.m_Name, archetype);
+        if (outIDs) outIDs[i] = entity->GetID();
+    }
+
+    // Kolon kolon doldur: her kolon chunk icinde ardisik yazilir
+    const ComponentInfo* transformInfo = ComponentInfo::Get<Transform>();
+    for (const Prefab::Entry& entry : prefab.m_Components) {
+        const ComponentInfo* info = entry.info;
+        int column = archetype->GetColumn(info);
+        bool perInstance = transforms && info == transformInfo;
+
+        for (uint32_t i = 0; i < count; ++i) {
+            void* dst = archetype->GetComponent(firstRow + i, column);
+            const void* src = perInstance ? static_cast<const void*>(&transforms[i]) : entry.data;
+            if (info->trivial) {
+                std::memcpy(dst, src, info->size);
+            } else {
+                info->copyConstruct(dst, src);
+            }
+        }
+    }
+}
+
+Entity* Scene::Instantiate(const Prefab& prefab, const Transform* transform) {
+    EntityID id = NullEntity;
+    Instantiate(prefab, 1, transform, &id);
+    return GetEntity(id);
 }
 
 void Scene::DestroyEntity(EntityID id) {
-    auto it = std::remove_if(m_Entities.begin(), m_Entities.end(),
-        [id](const std::shared_ptr<Entity>& entity) {
-            return entity->GetID() == id;
-        });
-    m_Entities.erase(it, m_Entities.end());
+    Entity* entity = GetEntity(id);
+    if (!entity) return;
+
+    ++m_FrameCounters.entitiesDestroyed;
+    CountComponents(entity->m_Archetype->GetMask(), m_FrameCounters.removed, 1);
+
+    if (Entity* moved = entity->m_Archetype->RemoveRow(entity->m_Row)) {
+        moved->m_Row = entity->m_Row;
+    }
+
+    // Yogun listeden swap-remove
+    Entity* last = m_Entities.back();
+    m_Entities[entity->m_DenseIndex] = last;
+    last->m_DenseIndex = entity->m_DenseIndex;
+    m_Entities.pop_back();
+    RemoveFromNameIndex(entity);
+
+    uint32_t index = GetEntityIndex(id);
+    EntitySlot& slot = m_Slots[index];
+    slot.entity->~Entity();
+    slot.entity = nullptr;
+
+    // Nesil 0 NullEntity icin ayrilmis; tasmada atla
+    if (++slot.generation == 0) {
+        slot.generation = 1;
+    }
+    m_FreeSlots.push_back(index);
 }
 
 Entity* Scene::GetEntity(EntityID id) {
-    for (auto& entity : m_Entities) {
-        if (entity->GetID() == id) {
-            return entity.get();
+    uint32_t index = GetEntityIndex(id);
+    if (index >= m_Slots.size()) return nullptr;
+
+    EntitySlot& slot = m_Slots[index];
+    if (slot.generation != GetEntityGeneration(id)) return nullptr;
+    return slot.entity;
+}
+
+void Scene::AddToNameIndex(Entity* entity) {
+    std::vector<Entity*>& entities = m_NameIndex[entity->m_Name];
+    entity->m_NameIndex = static_cast<uint32_t>(entities.size());
+    entities.push_back(entity);
+}
+
+void Scene::RemoveFromNameIndex(Entity* entity) {
+    // Dense liste gibi swap-remove: O(1)
+    std::vector<Entity*>& entities = m_NameIndex[entity->m_Name];
+    Entity* last = entities.back();
+    entities[entity->m_NameIndex] = last;
+    last->m_NameIndex = entity->m_NameIndex;
+    entities.pop_back();
+}
+
+Entity* Scene::FindEntityByName(StringID name) const {
+    const std::vector<Entity*>& entities = FindEntitiesByName(name);
+    return entities.empty() ? nullptr : entities.front();
+}
+
+const std::vector<Entity*>& Scene::FindEntitiesByName(StringID name) const {
+    static const std::vector<Entity*> s_Empty;
+    auto it = m_NameIndex.find(name);
+    return it != m_NameIndex.end() ? it->second : s_Empty;
+}
+
+bool Scene::IsValid(EntityID id) const {
+    uint32_t index = GetEntityIndex(id);
+    return index < m_Slots.size()
+        && m_Slots[index].generation == GetEntityGeneration(id)
+        && m_Slots[index].entity != nullptr;
+}
+
+void Scene::SetParent(EntityID child, EntityID parent) {
+    Entity* childEntity = GetEntity(child);
+    if (!childEntity) return;
+
+    if (parent != NullEntity) {
+        if (!GetEntity(parent)) return;
+
+        // Dongu kontrolu: child, parent'in atalarindan biri olmamali
+        for (EntityID ancestor = parent; ancestor != NullEntity; ancestor = GetParent(ancestor)) {
+            if (ancestor == child) return;
+        }
+
+        childEntity->AddComponent<Parent>()->entity = parent;
+    } else {
+        childEntity->RemoveComponent<Parent>();
+    }
+
+    // Dunya matrisi TransformSystem'de yeniden hesaplansin
+    Transform* transform = childEntity->GetComponent<Transform>();
+    transform->m_HasParent = parent != NullEntity;
+    transform->MarkDirty();
+    ++m_HierarchyVersion;
+}
+
+EntityID Scene::GetParent(EntityID child) {
+    Entity* entity = GetEntity(child);
+    if (!entity) return NullEntity;
+
+    Parent* parent = entity->GetComponent<Parent>();
+    return parent ? parent->entity : NullEntity;
+}
+
+Archetype* Scene::GetOrCreateArchetype(std::vector<const ComponentInfo*> signature) {
+    // Ayni component kumesi ayni maskeyi verir; imza sirasi fark etmez
+    ComponentMask mask;
+    for (const ComponentInfo* info : signature) {
+        mask.set(info->id);
+    }
+
+    auto it = m_ArchetypeLookup.find(mask);
+    if (it != m_ArchetypeLookup.end()) {
+        return it->second;
+    }
+
+    // Kolonlar tip ID sirasinda
+    std::sort(signature.begin(), signature.end(),
+        [](const ComponentInfo* a, const ComponentInfo* b) { return a->id < b->id; });
+
+    auto archetype = std::make_unique<Archetype>(std::move(signature), &m_ChunkPool);
+    Archetype* result = archetype.get();
+    m_Archetypes.push_back(std::move(archetype));
+    m_ArchetypeLookup[mask] = result;
+    return result;
+}
+
+Archetype* Scene::FindArchetype(const ComponentMask& mask) const {
+    auto it = m_ArchetypeLookup.find(mask);
+    return it != m_ArchetypeLookup.end() ? it->second : nullptr;
+}
+
+Archetype* Scene::GetArchetypeWith(Archetype* from, const ComponentInfo* info) {
+    if (Archetype* cached = from->GetAddEdge(info)) {
+        return cached;
+    }
+
+    std::vector<const ComponentInfo*> signature = from->GetSignature();
+    signature.push_back(info);
+    Archetype* target = GetOrCreateArchetype(std::move(signature));
+
+    from->SetAddEdge(info, target);
+    target->SetRemoveEdge(info, from);
+    return target;
+}
+
+Archetype* Scene::GetArchetypeWithout(Archetype* from, const ComponentInfo* info) {
+    if (Archetype* cached = from->GetRemoveEdge(info)) {
+        return cached;
+    }
+
+    std::vector<const ComponentInfo*> signature = from->GetSignature();
+    signature.erase(std::remove(signature.begin(), signature.end(), info), signature.end());
+    Archetype* target = GetOrCreateArchetype(std::move(signature));
+
+    from->SetRemoveEdge(info, target);
+    target->SetAddEdge(info, from);
+    return target;
+}
+
+size_t Scene::NextQueryID() {
+    static std::atomic<size_t> s_NextID{0};
+    return s_NextID++;
+}
+
+std::shared_ptr<const std::vector<Archetype*>> Scene::GetQueryMatches(size_t queryID, std::initializer_list<const ComponentInfo*> required) {
+    std::lock_guard<std::mutex> lock(m_QueryMutex);
+
+    if (queryID >= m_Queries.size()) {
+        m_Queries.resize(queryID + 1);
+    }
+
+    auto& query = m_Queries[queryID];
+    if (!query) {
+        query = std::make_unique<Query>();
+        query->matches = std::make_shared<const std::vector<Archetype*>>();
+        for (const ComponentInfo* info : required) {
+            query->required.set(info->id);
         }
     }
-    return nullptr;
+
+    // Son taramadan beri olusan archetype'lari kontrol et; eslesme varsa yeni liste
+    // olusturulur (acik view'lar eski listeyi gezmeye devam eder)
+    std::shared_ptr<std::vector<Archetype*>> updated;
+    for (size_t i = query->scannedArchetypes; i < m_Archetypes.size(); ++i) {
+        Archetype* archetype = m_Archetypes[i].get();
+        if ((archetype->GetMask() & query->required) == query->required) {
+            if (!updated) {
+                updated = std::make_shared<std::vector<Archetype*>>(*query->matches);
+            }
+            updated->push_back(archetype);
+        }
+    }
+    query->scannedArchetypes = m_Archetypes.size();
+    if (updated) {
+        query->matches = std::move(updated);
+    }
+
+    return query->matches;
+}
+
+void Scene::MoveEntity(Entity* entity, Archetype* target) {
+    if (entity->m_Archetype == target) return;
+
+    const ComponentMask& source = entity->m_Archetype->GetMask();
+    ++m_FrameCounters.archetypeMoves;
+    CountComponents(target->GetMask() & ~source, m_FrameCounters.added, 1);
+    CountComponents(source & ~target->GetMask(), m_FrameCounters.removed, 1);
+
+    Entity* moved = nullptr;
+    uint32_t newRow = entity->m_Archetype->MoveRow(entity->m_Row, *target, &moved);
+    if (moved) {
+        moved->m_Row = entity->m_Row;
+    }
+
+    entity->m_Archetype = target;
+    entity->m_Row = newRow;
+}
+
+void Scene::CountComponents(const ComponentMask& mask, std::array<uint32_t, MAX_COMPONENTS>& counters, uint32_t count) {
+    if (mask.none()) return;
+
+    size_t typeCount = ComponentInfo::GetTypeCount();
+    for (size_t id = 0; id < typeCount; ++id) {
+        if (mask.test(id)) {
+            counters[id] += count;
+        }
+    }
+}
+
+void Scene::EndStatsFrame() {
+    // Chunk sayaclari archetype'larda birikir; frame farki burada alinir
+    uint64_t allocations = 0;
+    uint64_t releases = 0;
+    for (const auto& archetype : m_Archetypes) {
+        allocations += archetype->GetChunkAllocations();
+        releases += archetype->GetChunkReleases();
+    }
+
+    m_FrameCounters.chunkAllocations = static_cast<uint32_t>(allocations - m_ChunkAllocationsAtFrameStart);
+    m_FrameCounters.chunkReleases = static_cast<uint32_t>(releases - m_ChunkReleasesAtFrameStart);
+    m_ChunkAllocationsAtFrameStart = allocations;
+    m_ChunkReleasesAtFrameStart = releases;
+
+    m_LastFrameCounters = m_FrameCounters;
+    m_FrameCounters = SceneFrameCounters{};
+}
+
+void Scene::GetStats(SceneStats& out) const {
+    out.components.assign(ComponentInfo::GetTypeCount(), ComponentTypeStats{});
+    out.archetypes.clear();
+    out.archetypeCount = 0;
+    out.emptyArchetypeCount = 0;
+    out.chunkBytes = 0;
+    out.usedChunkBytes = 0;
+
+    for (const auto& archetype : m_Archetypes) {
+        uint32_t entities = archetype->GetEntityCount();
+        size_t chunks = archetype->GetAllocatedChunkCount();
+        uint32_t capacity = static_cast<uint32_t>(chunks) * archetype->GetChunkCapacity();
+
+        out.chunkBytes += chunks * archetype->GetChunkBytes();
+        out.usedChunkBytes += entities * archetype->GetRowSize();
+
+        for (const ComponentInfo* info : archetype->GetSignature()) {
+            ComponentTypeStats& type = out.components[info->id];
+            type.info = info;
+            type.count += entities;
+            type.bytes += entities * info->size;
+            type.reservedBytes += capacity * info->size;
+        }
+
+        if (entities == 0) {
+            ++out.emptyArchetypeCount;
+            continue;
+        }
+
+        ++out.archetypeCount;
+        ArchetypeStats stats;
+        stats.archetype = archetype.get();
+        stats.entities = entities;
+        stats.capacity = capacity;
+        stats.chunks = chunks;
+        stats.allocatedBytes = chunks * archetype->GetChunkBytes();
+        stats.usedBytes = entities * archetype->GetRowSize();
+        out.archetypes.push_back(stats);
+    }
+
+    out.lastFrame = m_LastFrameCounters;
+    for (ComponentTypeStats& type : out.components) {
+        if (type.info) {
+            type.added = m_LastFrameCounters.added[type.info->id];
+            type.removed = m_LastFrameCounters.removed[type.info->id];
+        }
+    }
+
+    out.entityCount = static_cast<uint32_t>(m_Entities.size());
+    out.entityBytes = m_EntityPages.size() * sizeof(EntityPage)
+        + m_Slots.capacity() * sizeof(EntitySlot)
+        + m_Entities.capacity() * sizeof(Entity*);
+    out.snapshotBytes = m_Snapshots.GetUsedBytes();
+    out.idleChunkBytes = m_ChunkPool.GetReservedMemory() - m_ChunkPool.GetUsedMemory();
 }
 
 } // namespace Archura
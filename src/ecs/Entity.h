@@ -1,91 +1,285 @@
 #pragma once
 
 #include "Component.h"
+#include "Archetype.h"
+#include "CommandBuffer.h"
+#include "EntityID.h"
+#include "EventBus.h"
+#include "SceneStats.h"
+#include "Snapshot.h"
+#include "View.h"
+#include "../core/StringID.h"
+#include "../core/memory/PoolAllocator.h"
+#include "../core/memory/VirtualArena.h"
+#include <initializer_list>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <memory>
-#include <typeindex>
 #include <unordered_map>
+#include <memory>
+#include <mutex>
 
 namespace Archura {
 
-using EntityID = uint32_t;
+class Scene;
+class Prefab;
 
 /**
  * @brief Entity sınıfı - Basit ECS implementasyonu
- * 
- * Her entity bir ID'ye ve component'lere sahiptir
+ *
+ * Her entity bir ID'ye ve component'lere sahiptir. Component verisi entity'de
+ * degil, Scene'in archetype deposunda tutulur; Entity sadece konumunu bilir.
+ *
+ * Not: AddComponent/RemoveComponent entity'i baska bir archetype'a tasir ve bu
+ * entity icin daha once alinmis component isaretcilerini gecersiz kilar.
  */
 class Entity {
 public:
-    Entity(EntityID id, const std::string& name = "Entity");
+    Entity(Scene* scene, EntityID id, StringID name = "Entity");
     ~Entity() = default;
 
     EntityID GetID() const { return m_ID; }
-    const std::string& GetName() const { return m_Name; }
-    void SetName(const std::string& name) { m_Name = name; }
+    const std::string& GetName() const { return m_Name.GetString(); }
+    StringID GetNameID() const { return m_Name; }
+    void SetName(StringID name);
 
     // Component yönetimi
     template<typename T, typename... Args>
-    T* AddComponent(Args&&... args) {
-        std::type_index typeIndex = typeid(T);
-        
-        // Zaten varsa eski component'i döndür
-        if (m_Components.find(typeIndex) != m_Components.end()) {
-            return static_cast<T*>(m_Components[typeIndex].get());
-        }
-        
-        auto component = std::make_shared<T>(std::forward<Args>(args)...);
-        m_Components[typeIndex] = component;
-        return component.get();
-    }
+    T* AddComponent(Args&&... args);
 
     template<typename T>
-    T* GetComponent() {
-        std::type_index typeIndex = typeid(T);
-        auto it = m_Components.find(typeIndex);
-        if (it != m_Components.end()) {
-            return static_cast<T*>(it->second.get());
-        }
-        return nullptr;
-    }
+    T* GetComponent();
 
     template<typename T>
-    bool HasComponent() {
-        std::type_index typeIndex = typeid(T);
-        return m_Components.find(typeIndex) != m_Components.end();
-    }
+    bool HasComponent();
 
     template<typename T>
-    void RemoveComponent() {
-        std::type_index typeIndex = typeid(T);
-        m_Components.erase(typeIndex);
-    }
+    void RemoveComponent();
+
+    // Sahip olunan component'lerin bit maskesi (archetype'tan gelir)
+    const ComponentMask& GetComponentMask() const { return m_Archetype->GetMask(); }
 
 private:
+    friend class Scene;
+    friend class CommandBuffer;
+    friend class SnapshotRing;
+
+    Scene* m_Scene;
     EntityID m_ID;
-    std::string m_Name;
-    std::unordered_map<std::type_index, std::shared_ptr<Component>> m_Components;
+    StringID m_Name;  // Intern edilmis: ayni isimli entity'ler metni paylasir
+
+    // Archetype deposundaki konum
+    Archetype* m_Archetype = nullptr;
+    uint32_t m_Row = 0;
+
+    // Scene::GetEntities() listesindeki konum
+    uint32_t m_DenseIndex = 0;
+
+    // Scene isim indeksindeki konum
+    uint32_t m_NameIndex = 0;
 };
 
 /**
- * @brief Scene sınıfı - Entity'leri yönetir
+ * @brief Scene sınıfı - Entity'leri ve archetype depolarini yönetir
  */
 class Scene {
 public:
     Scene(const std::string& name = "Default Scene");
-    ~Scene() = default;
+    ~Scene();
+
+    Scene(const Scene&) = delete;
+    Scene& operator=(const Scene&) = delete;
+
+    Entity* CreateEntity(StringID name = "Entity");
 
-    Entity* CreateEntity(const std::string& name = "Entity");
+    // Prefab'tan count entity: archetype chunk'lari toplu ayrilir, component'ler
+    // memcpy/kopya ile doldurulur. transforms verilirse i. entity transforms[i] alir.
+    // outIDs verilirse count elemanli olmali.
+    void Instantiate(const Prefab& prefab, uint32_t count, const Transform* transforms = nullptr, EntityID* outIDs = nullptr);
+    Entity* Instantiate(const Prefab& prefab, const Transform* transform = nullptr);
+
+    // O(1); eski (stale) veya gecersiz ID'ler sessizce yoksayilir
     void DestroyEntity(EntityID id);
+
+    // O(1); entity silinmisse nullptr
     Entity* GetEntity(EntityID id);
-    
-    const std::vector<std::shared_ptr<Entity>>& GetEntities() const { return m_Entities; }
+    bool IsValid(EntityID id) const;
+
+    // Canli entity'lerin yogun listesi (silme sirayi degistirebilir)
+    const std::vector<Entity*>& GetEntities() const { return m_Entities; }
+
+    // Isim indeksi: O(1) arama. Ayni isimde birden fazla entity olabilir; liste
+    // olusturma/silme/yeniden adlandirmada degisir (sira garanti edilmez).
+    // string_view surumleri metni intern etmez, bilinmeyen isim icin bos doner.
+    Entity* FindEntityByName(StringID name) const;
+    Entity* FindEntityByName(std::string_view name) const { return FindEntityByName(StringID::Find(name)); }
+    Entity* FindEntityByName(const std::string& name) const { return FindEntityByName(std::string_view(name)); }
+    Entity* FindEntityByName(const char* name) const { return FindEntityByName(std::string_view(name)); }
+
+    const std::vector<Entity*>& FindEntitiesByName(StringID name) const;
+    const std::vector<Entity*>& FindEntitiesByName(std::string_view name) const { return FindEntitiesByName(StringID::Find(name)); }
+    const std::vector<Entity*>& FindEntitiesByName(const std::string& name) const { return FindEntitiesByName(std::string_view(name)); }
+    const std::vector<Entity*>& FindEntitiesByName(const char* name) const { return FindEntitiesByName(std::string_view(name)); }
+
+    // Chunk bazli dogrusal iterasyon icin archetype listesi
+    const std::vector<std::unique_ptr<Archetype>>& GetArchetypes() const { return m_Archetypes; }
+
+    // Transform hiyerarsisi (ana thread). parent NullEntity ise entity koke tasinir;
+    // dongu olusturacak atamalar yoksayilir. Child'in TRS'i parent'a gore yereldir.
+    void SetParent(EntityID child, EntityID parent);
+    EntityID GetParent(EntityID child);
+    uint32_t GetHierarchyVersion() const { return m_HierarchyVersion; }
+
+    // Sadece Ts component'lerinin hepsine sahip entity'leri gezen sorgu
+    template<typename... Ts>
+    SceneView<Ts...> View() {
+        return SceneView<Ts...>(GetQueryMatches(GetQueryID<Ts...>(), { ComponentInfo::Get<Ts>()... }));
+    }
+
+    // Iterasyon sirasinda yapisal degisiklikler buraya kaydedilir
+    CommandBuffer& GetCommandBuffer() { return m_CommandBuffer; }
+
+    // Bekleyen komutlari uygular; frame'de sistemler bittikten sonra cagrilir
+    void FlushCommands() { m_CommandBuffer.Playback(*this); }
+
+    // Frame omurlu olaylar (isabet, hasar, trigger...); frame sonunda EndFrame ile silinir
+    EventBus& GetEvents() { return m_Events; }
+
+    // Component durumu gecmisi (geri sarma/tekrar). Snapshot frame numarasini dondurur;
+    // Restore sadece component degerlerini geri yazar, frame halkadan dusmusse false.
+    uint32_t Snapshot() { return m_Snapshots.Capture(*this); }
+    bool Restore(uint32_t frame) { return m_Snapshots.Restore(*this, frame); }
+    SnapshotRing& GetSnapshots() { return m_Snapshots; }
+
+    // ECS bellek/doluluk profili. GetStats anlik durumu ve son kapatilan frame'in
+    // sayaclarini doldurur; EndStatsFrame frame sonunda (ana thread) bir kez cagrilir.
+    void GetStats(SceneStats& out) const;
+    void EndStatsFrame();
 
 private:
+    friend class Entity;
+    friend class CommandBuffer;
+    friend class SnapshotRing;
+
+    // Onbellekli sorgu: eslesen archetype'lar sadece yeni archetype olusunca guncellenir
+    // matches degismez: yeni archetype eslesince kopyalanip degistirilir, boylece
+    // baska thread'de gezilen eski liste gecerli kalir
+    struct Query {
+        ComponentMask required;
+        std::shared_ptr<const std::vector<Archetype*>> matches;
+        size_t scannedArchetypes = 0;
+    };
+
+    static size_t NextQueryID();
+
+    template<typename... Ts>
+    static size_t GetQueryID() {
+        static const size_t id = NextQueryID();
+        return id;
+    }
+
+    std::shared_ptr<const std::vector<Archetype*>> GetQueryMatches(size_t queryID, std::initializer_list<const ComponentInfo*> required);
+
+    Archetype* GetOrCreateArchetype(std::vector<const ComponentInfo*> signature);
+    Archetype* FindArchetype(const ComponentMask& mask) const;  // Yoksa nullptr (imza kopyalanmaz)
+    Archetype* GetArchetypeWith(Archetype* from, const ComponentInfo* info);
+    Archetype* GetArchetypeWithout(Archetype* from, const ComponentInfo* info);
+    void MoveEntity(Entity* entity, Archetype* target);
+
+    // Slot map: EntityID indeksi slotu, nesil sayaci eski ID'leri ayirt eder
+    struct EntitySlot {
+        Entity* entity = nullptr;
+        uint32_t generation = 1;
+    };
+
+    // Entity nesneleri sabit sayfalarda yasar: tek tek heap ayirma yok, adresler sabit
+    static constexpr uint32_t ENTITY_PAGE_SIZE = 1024;
+    struct EntityPage {
+        alignas(Entity) std::byte storage[sizeof(Entity) * ENTITY_PAGE_SIZE];
+    };
+
+    uint32_t AcquireSlot();
+    Entity* ConstructEntity(uint32_t index, StringID name, Archetype* archetype);
+
+    void AddToNameIndex(Entity* entity);
+    void RemoveFromNameIndex(Entity* entity);
+
+    // Maskedeki her tip icin sayaci count kadar arttirir
+    static void CountComponents(const ComponentMask& mask, std::array<uint32_t, MAX_COMPONENTS>& counters, uint32_t count);
+
     std::string m_Name;
-    EntityID m_NextEntityID = 1;
-    std::vector<std::shared_ptr<Entity>> m_Entities;
+
+    // Standart boyuttaki archetype chunk'lari: bosalan chunk'lar heap'e donmez, tekrar kullanilir
+    // (archetype'lardan once yok edilmemeli, bu yuzden once tanimli). Bloklar ayrilmis sanal
+    // adres araligindan gelir: sahne buyudukce sayfalar commit edilir, chunk'lar hic tasinmaz
+    static constexpr size_t CHUNKS_PER_POOL_BLOCK = 16;
+    static constexpr size_t CHUNK_ARENA_RESERVE = size_t(1) << (sizeof(void*) == 8 ? 34 : 28);  // 16 GB / 256 MB
+    VirtualArena m_ChunkArena;
+    PoolAllocator m_ChunkPool;
+
+    // Component depolari (her benzersiz component kumesi icin bir archetype)
+    std::vector<std::unique_ptr<Archetype>> m_Archetypes;
+    std::unordered_map<ComponentMask, Archetype*> m_ArchetypeLookup;
+    Archetype* m_RootArchetype = nullptr;
+    Archetype* m_TransformArchetype = nullptr;  // CreateEntity'nin hedefi
+    std::vector<std::unique_ptr<Query>> m_Queries;
+    std::mutex m_QueryMutex;  // View() paralel sistemlerden cagrilabilir
+
+    std::vector<EntitySlot> m_Slots;
+    std::vector<std::unique_ptr<EntityPage>> m_EntityPages;
+    std::vector<uint32_t> m_FreeSlots;
+    std::vector<Entity*> m_Entities;
+    std::unordered_map<StringID, std::vector<Entity*>> m_NameIndex;  // Bos listeler tekrar kullanim icin kalir
+    uint32_t m_HierarchyVersion = 0;
+
+    // Profiler: acik frame'in sayaclari, son kapatilan frame ve chunk sayaclarinin frame basi degeri
+    SceneFrameCounters m_FrameCounters;
+    SceneFrameCounters m_LastFrameCounters;
+    uint64_t m_ChunkAllocationsAtFrameStart = 0;
+    uint64_t m_ChunkReleasesAtFrameStart = 0;
+
+    CommandBuffer m_CommandBuffer;
+    EventBus m_Events;
+    SnapshotRing m_Snapshots;
 };
 
+// ==================== Entity template'leri ====================
+
+template<typename T, typename... Args>
+T* Entity::AddComponent(Args&&... args) {
+    // Zaten varsa eski component'i döndür
+    if (T* existing = GetComponent<T>()) {
+        return existing;
+    }
+
+    const ComponentInfo* info = ComponentInfo::Get<T>();
+    m_Scene->MoveEntity(this, m_Scene->GetArchetypeWith(m_Archetype, info));
+
+    void* memory = m_Archetype->GetComponent(m_Row, m_Archetype->GetColumn(info));
+    return new (memory) T(std::forward<Args>(args)...);
+}
+
+template<typename T>
+T* Entity::GetComponent() {
+    int column = m_Archetype->GetColumn(ComponentInfo::Get<T>());
+    if (column < 0) {
+        return nullptr;
+    }
+    return static_cast<T*>(m_Archetype->GetComponent(m_Row, column));
+}
+
+template<typename T>
+bool Entity::HasComponent() {
+    return m_Archetype->Has(ComponentInfo::Get<T>());
+}
+
+template<typename T>
+void Entity::RemoveComponent() {
+    const ComponentInfo* info = ComponentInfo::Get<T>();
+    if (!m_Archetype->Has(info)) {
+        return;
+    }
+    m_Scene->MoveEntity(this, m_Scene->GetArchetypeWithout(m_Archetype, info));
+}
+
 } // namespace Archura
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Archura {
+
+/**
+ * @brief EntityID - 64 bit nesilli (generational) entity tutamaci
+ *
+ * Alt 32 bit Scene slot indeksi, ust 32 bit o slotun nesil sayacidir.
+ * Entity silinip slot tekrar kullanildiginda nesil artar; boylece eski
+ * ID'ler yeni entity'i gostermez, Scene::GetEntity nullptr dondurur.
+ */
+using EntityID = uint64_t;
+
+constexpr EntityID NullEntity = 0; // Nesil 0 hicbir zaman kullanilmaz
+
+inline constexpr EntityID MakeEntityID(uint32_t index, uint32_t generation) {
+    return (static_cast<EntityID>(generation) << 32) | index;
+}
+
+inline constexpr uint32_t GetEntityIndex(EntityID id) {
+    return static_cast<uint32_t>(id & 0xFFFFFFFFu);
+}
+
+inline constexpr uint32_t GetEntityGeneration(EntityID id) {
+    return static_cast<uint32_t>(id >> 32);
+}
+
+} // namespace Archura
@@ -0,0 +1,217 @@
+#include "EventBus.h"
+#include "../core/memory/MemoryTracker.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+
+namespace Archura {
+
+namespace {
+
+constexpr uint32_t NO_THREAD_SLOT = 0xFFFFFFFFu;
+
+std::atomic<EventTypeID> s_EventTypeCount{0};
+
+// Thread slot'lari tum EventBus'larda ortak; thread bitince slot (ve ring'leri)
+// bir sonraki yeni thread'e verilir. JobSystem yeniden kuruldukca MAX_THREADS dolmaz
+struct ThreadSlotRegistry {
+    std::mutex mutex;
+    std::vector<uint32_t> freeSlots;
+    uint32_t nextSlot = 0;
+};
+
+ThreadSlotRegistry& GetSlotRegistry() {
+    static ThreadSlotRegistry registry;
+    return registry;
+}
+
+struct ThreadSlot {
+    uint32_t value = NO_THREAD_SLOT;
+
+    ThreadSlot() {
+        ThreadSlotRegistry& registry = GetSlotRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        if (!registry.freeSlots.empty()) {
+            value = registry.freeSlots.back();
+            registry.freeSlots.pop_back();
+        } else if (registry.nextSlot < EventBus::MAX_THREADS) {
+            value = registry.nextSlot++;
+        }
+    }
+
+    // Eski sahip son yayinini yapmistir; mutex yeni sahibe head'in gorunmesini saglar
+    ~ThreadSlot() {
+        if (value == NO_THREAD_SLOT) return;
+        ThreadSlotRegistry& registry = GetSlotRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.freeSlots.push_back(value);
+    }
+};
+
+} // namespace
+
+EventTypeID EventBus::NextTypeID() {
+    EventTypeID id = s_EventTypeCount++;
+    // Release'te de durdurulur: kanal tablosu MAX_EVENT_TYPES boyutunda
+    if (id >= MAX_EVENT_TYPES) {
+        std::cerr << "Fatal: more than MAX_EVENT_TYPES (" << MAX_EVENT_TYPES << ") event types registered\n";
+        std::abort();
+    }
+    return id;
+}
+
+uint32_t EventBus::GetThreadSlot() {
+    thread_local ThreadSlot slot;
+    return slot.value;
+}
+
+EventBus::~EventBus() = default;
+
+EventBus::Channel& EventBus::GetChannel(EventTypeID id, size_t elementSize, size_t alignment) {
+    Channel* channel = m_Channels[id].load(std::memory_order_acquire);
+    if (channel) return *channel;
+
+    // Ilk yayin: kanal kilit altinda bir kez olusturulur
+    std::lock_guard<std::mutex> lock(m_ChannelMutex);
+    channel = m_Channels[id].load(std::memory_order_relaxed);
+    if (!channel) {
+        m_OwnedChannels.push_back(std::make_unique<Channel>(elementSize, alignment, DEFAULT_CAPACITY));
+        channel = m_OwnedChannels.back().get();
+        m_Channels[id].store(channel, std::memory_order_release);
+    }
+    return *channel;
+}
+
+void EventBus::EndFrame() {
+    m_Discarded = 0;
+    m_Spilled = 0;
+    for (const auto& channel : m_OwnedChannels) {
+        m_Discarded += static_cast<uint32_t>(channel->Clear());
+        m_Spilled += channel->TakeSpilled();
+    }
+}
+
+// ==================== Channel ====================
+
+EventBus::Channel::Channel(size_t elementSize, size_t alignment, uint32_t capacity)
+    : m_ElementSize(elementSize)
+    , m_Alignment(std::max(alignment, alignof(std::max_align_t)))
+    , m_Capacity(capacity)
+{
+    assert((capacity & (capacity - 1)) == 0 && "Kapasite 2'nin kuvveti olmali");
+}
+
+EventBus::Channel::~Channel() {
+    for (const auto& ring : m_OwnedRings) {
+        ::operator delete(ring->data, std::align_val_t(m_Alignment));
+    }
+}
+
+EventBus::Ring* EventBus::Channel::CreateRing(uint32_t slot) {
+    auto ring = std::make_unique<Ring>();
+    ring->data = static_cast<std::byte*>(::operator new(m_ElementSize * m_Capacity, std::align_val_t(m_Alignment)));
+    ARCH_TRACK_ALLOC(ring->data, m_ElementSize * m_Capacity, MemoryTag::ECS);
+    ring->capacity = m_Capacity;
+
+    Ring* result = ring.get();
+    {
+        std::lock_guard<std::mutex> lock(m_RingMutex);
+        m_OwnedRings.push_back(std::move(ring));
+    }
+    m_Rings[slot].store(result, std::memory_order_release);
+    return result;
+}
+
+void EventBus::Channel::Publish(const void* event) {
+    // Slot'un ring'ini sadece sahibi olusturur ve yazar
+    uint32_t slot = GetThreadSlot();
+    if (slot < MAX_THREADS) {
+        Ring* ring = m_Rings[slot].load(std::memory_order_relaxed);
+        if (!ring) {
+            ring = CreateRing(slot);
+        }
+
+        uint32_t head = ring->head.load(std::memory_order_relaxed);
+        uint32_t tail = ring->tail.load(std::memory_order_acquire);
+        if (head - tail < ring->capacity) {
+            std::memcpy(ring->data + (head & (ring->capacity - 1)) * m_ElementSize, event, m_ElementSize);
+            ring->head.store(head + 1, std::memory_order_release);
+            return;
+        }
+    }
+
+    // Ring dolu (veya ayni anda MAX_THREADS'i asan thread): olay tasma dizisine (kilitli) yazilir
+    const std::byte* bytes = static_cast<const std::byte*>(event);
+    std::lock_guard<std::mutex> lock(m_SpillMutex);
+    m_Spill.insert(m_Spill.end(), bytes, bytes + m_ElementSize);
+    m_Spilled.fetch_add(1, std::memory_order_relaxed);
+}
+
+void EventBus::Channel::Visit(void (*visit)(void* context, const std::byte* events, size_t count), void* context, bool consume) {
+    for (const auto& slot : m_Rings) {
+        Ring* ring = slot.load(std::memory_order_acquire);
+        if (!ring) continue;
+
+        uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+        uint32_t head = ring->head.load(std::memory_order_acquire);
+        uint32_t count = head - tail;
+        if (count == 0) continue;
+
+        // Sarmalanan kisim ikinci bir ardisik dizi olarak verilir
+        uint32_t start = tail & (ring->capacity - 1);
+        uint32_t first = std::min(count, ring->capacity - start);
+        visit(context, ring->data + start * m_ElementSize, first);
+        if (count > first) {
+            visit(context, ring->data, count - first);
+        }
+
+        if (consume) {
+            ring->tail.store(head, std::memory_order_release);
+        }
+    }
+
+    if (consume) {
+        {
+            std::lock_guard<std::mutex> lock(m_SpillMutex);
+            if (m_Spill.empty()) return;
+            m_SpillScratch.swap(m_Spill);
+        }
+        visit(context, m_SpillScratch.data(), m_SpillScratch.size() / m_ElementSize);
+        m_SpillScratch.clear();
+    } else {
+        std::lock_guard<std::mutex> lock(m_SpillMutex);
+        if (!m_Spill.empty()) {
+            visit(context, m_Spill.data(), m_Spill.size() / m_ElementSize);
+        }
+    }
+}
+
+size_t EventBus::Channel::GetPendingCount() const {
+    size_t count = 0;
+    for (const auto& slot : m_Rings) {
+        if (Ring* ring = slot.load(std::memory_order_acquire)) {
+            count += ring->head.load(std::memory_order_acquire) - ring->tail.load(std::memory_order_relaxed);
+        }
+    }
+    return count;  // Tasma haric (nadir)
+}
+
+size_t EventBus::Channel::Clear() {
+    size_t discarded = 0;
+    for (const auto& slot : m_Rings) {
+        if (Ring* ring = slot.load(std::memory_order_acquire)) {
+            uint32_t head = ring->head.load(std::memory_order_acquire);
+            discarded += head - ring->tail.load(std::memory_order_relaxed);
+            ring->tail.store(head, std::memory_order_release);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_SpillMutex);
+    discarded += m_Spill.size() / m_ElementSize;
+    m_Spill.clear();
+    return discarded;
+}
+
+} // namespace Archura
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace Archura {
+
+using EventTypeID = uint32_t;
+
+/**
+ * @brief EventBus - Frame omurlu, tipli olay kuyrugu
+ *
+ * Ureticiler (sistemler, JobSystem worker'lari dahil) Publish ile olay ekler;
+ * her olay tipi icin her thread'in kendi ring buffer'i vardir, bu yuzden
+ * yayinlama kilitsizdir. Ring dolarsa olay kilitli bir tasma (spill) dizisine
+ * yazilir, kaybolmaz.
+ *
+ * Tuketiciler tanimli noktalarda (ornegin SystemScheduler bittikten sonra)
+ * ForEach/ForEachBatch ile olaylari ardisik diziler halinde okur. Ayni olayi
+ * birden fazla tuketici okuyabilir; EndFrame() tuketilmemis her seyi siler.
+ * Consume okuyup kuyruktan cikarir (sonraki tuketiciler gormez).
+ *
+ * Bir thread icindeki olaylar yayin sirasiyla gelir; thread'ler arasi sira
+ * tanimsizdir. Olay tipleri trivially copyable olmalidir.
+ *
+ * Not: Ayni olay tipini ayni anda sadece bir tuketici okumali; uretim
+ * tuketimle ayni anda olabilir (her ring tek uretici/tek tuketici).
+ */
+class EventBus {
+public:
+    static constexpr uint32_t MAX_THREADS = 64;
+    static constexpr uint32_t MAX_EVENT_TYPES = 32;
+    static constexpr uint32_t DEFAULT_CAPACITY = 1024;  // Thread basina, 2'nin kuvveti
+
+    EventBus() = default;
+    ~EventBus();
+
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
+
+    template<typename T>
+    void Publish(const T& event) {
+        static_assert(std::is_trivially_copyable_v<T>, "Olay tipleri trivially copyable olmali");
+        GetChannel(GetTypeID<T>(), sizeof(T), alignof(T)).Publish(&event);
+    }
+
+    // Bekleyen olaylari ardisik diziler halinde gezer (en fazla thread basina 2 + tasma)
+    template<typename T, typename Func>
+    void ForEachBatch(Func&& func) {
+        Visit<T>(func, false);
+    }
+
+    template<typename T, typename Func>
+    void ForEach(Func&& func) {
+        ForEachBatch<T>([&](const T* events, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                func(events[i]);
+            }
+        });
+    }
+
+    // ForEach + gezilen olaylari kuyruktan cikarir
+    template<typename T, typename Func>
+    void Consume(Func&& func) {
+        Visit<T>([&](const T* events, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                func(events[i]);
+            }
+        }, true);
+    }
+
+    template<typename T>
+    size_t GetPendingCount() const {
+        const Channel* channel = m_Channels[GetTypeID<T>()].load(std::memory_order_acquire);
+        return channel ? channel->GetPendingCount() : 0;
+    }
+
+    // Frame sonu (ana thread, ureticiler bittikten sonra): tuketilmemis olaylar silinir
+    void EndFrame();
+
+    // Son EndFrame'de silinen (hic tuketilmemis) olay sayisi ve frame'de tasmaya dusenler
+    uint32_t GetDiscardedCount() const { return m_Discarded; }
+    uint32_t GetSpilledCount() const { return m_Spilled; }
+
+private:
+    // Tek uretici (sahip thread) / tek tuketici ring; indeksler sarmalanir, maske ile erisilir
+    struct Ring {
+        std::byte* data = nullptr;
+        uint32_t capacity = 0;
+        std::atomic<uint32_t> head{0};  // Uretici yazar
+        std::atomic<uint32_t> tail{0};  // Tuketici yazar
+    };
+
+    class Channel {
+    public:
+        Channel(size_t elementSize, size_t alignment, uint32_t capacity);
+        ~Channel();
+
+        void Publish(const void* event);
+
+        // Ring'leri ve tasmayi gezer; consume ise gezilenler cikarilir
+        void Visit(void (*visit)(void* context, const std::byte* events, size_t count), void* context, bool consume);
+
+        size_t GetPendingCount() const;
+        size_t Clear();
+        uint32_t TakeSpilled() { return m_Spilled.exchange(0, std::memory_order_relaxed); }
+
+    private:
+        Ring* CreateRing(uint32_t slot);
+
+        size_t m_ElementSize;
+        size_t m_Alignment;
+        uint32_t m_Capacity;
+
+        std::array<std::atomic<Ring*>, MAX_THREADS> m_Rings{};
+        std::vector<std::unique_ptr<Ring>> m_OwnedRings;
+        std::mutex m_RingMutex;
+
+        std::mutex m_SpillMutex;
+        std::vector<std::byte> m_Spill;
+        std::vector<std::byte> m_SpillScratch;  // Consume'da tasma kilit disinda gezilir
+        std::atomic<uint32_t> m_Spilled{0};
+    };
+
+    template<typename T>
+    static EventTypeID GetTypeID() {
+        static const EventTypeID id = NextTypeID();
+        return id;
+    }
+
+    static EventTypeID NextTypeID();
+
+    // Her thread ilk yayininda bir slot alir, thread bitince slot geri verilir;
+    // ayni anda MAX_THREADS'i asan thread'ler tasmaya yazar
+    static uint32_t GetThreadSlot();
+
+    Channel& GetChannel(EventTypeID id, size_t elementSize, size_t alignment);
+
+    template<typename T, typename Func>
+    void Visit(Func&& func, bool consume) {
+        using F = std::remove_reference_t<Func>;
+        Channel* channel = m_Channels[GetTypeID<T>()].load(std::memory_order_acquire);
+        if (!channel) return;
+
+        channel->Visit([](void* context, const std::byte* events, size_t count) {
+            (*static_cast<F*>(context))(reinterpret_cast<const T*>(events), count);
+        }, const_cast<void*>(static_cast<const void*>(&func)), consume);
+    }
+
+    std::array<std::atomic<Channel*>, MAX_EVENT_TYPES> m_Channels{};
+    std::vector<std::unique_ptr<Channel>> m_OwnedChannels;
+    std::mutex m_ChannelMutex;
+
+    uint32_t m_Discarded = 0;
+    uint32_t m_Spilled = 0;
+};
+
+} // namespace Archura
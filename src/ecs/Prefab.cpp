@@ -0,0 +1,44 @@
+#include "Prefab.h"
+
+namespace Archura {
+
+Prefab::Prefab(StringID name)
+    : m_Name(name)
+{
+    AddComponent<Transform>();
+}
+
+Prefab::~Prefab() {
+    for (Entry& entry : m_Components) {
+        entry.info->destroy(entry.data);
+        ::operator delete(entry.data, std::align_val_t(entry.info->alignment));
+    }
+}
+
+void* Prefab::Allocate(const ComponentInfo* info) {
+    if (void* existing = Find(info)) {
+        info->destroy(existing);
+        return existing;
+    }
+
+    void* data = ::operator new(info->size, std::align_val_t(info->alignment));
+    m_Components.push_back({ info, data });
+    m_Signature.push_back(info);
+    m_Mask.set(info->id);
+    return data;
+}
+
+void* Prefab::Find(const ComponentInfo* info) const {
+    if (!m_Mask.test(info->id)) {
+        return nullptr;
+    }
+
+    for (const Entry& entry : m_Components) {
+        if (entry.info == info) {
+            return entry.data;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace Archura
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Archetype.h"
+#include "Component.h"
+#include "../core/StringID.h"
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Archura {
+
+/**
+ * @brief Prefab - Entity sablonu (component kumesi ve baslangic degerleri)
+ *
+ * Scene::Instantiate ile N kopya tek seferde olusturulur: hedef archetype'in
+ * chunk'lari toplu ayrilir, trivially copyable component'ler memcpy ile,
+ * digerleri kopya constructor ile doldurulur.
+ *
+ * Her prefab bir Transform icerir (her entity'de oldugu gibi).
+ *
+ * Kullanim:
+ *   Prefab bullet("Bullet");
+ *   bullet.AddComponent<MeshRenderer>()->mesh = mesh;
+ *   scene.Instantiate(bullet, 200, transforms);
+ */
+class Prefab {
+public:
+    explicit Prefab(StringID name = "Entity");
+    ~Prefab();
+
+    Prefab(const Prefab&) = delete;
+    Prefab& operator=(const Prefab&) = delete;
+
+    const std::string& GetName() const { return m_Name.GetString(); }
+    StringID GetNameID() const { return m_Name; }
+    void SetName(StringID name) { m_Name = name; }
+
+    // Zaten varsa eski deger yenisiyle degistirilir
+    template<typename T, typename... Args>
+    T* AddComponent(Args&&... args) {
+        const ComponentInfo* info = ComponentInfo::Get<T>();
+        void* memory = Allocate(info);
+        return new (memory) T(std::forward<Args>(args)...);
+    }
+
+    template<typename T>
+    T* GetComponent() const {
+        return static_cast<T*>(Find(ComponentInfo::Get<T>()));
+    }
+
+    template<typename T>
+    bool HasComponent() const {
+        return m_Mask.test(ComponentInfo::Get<T>()->id);
+    }
+
+private:
+    friend class Scene;
+
+    struct Entry {
+        const ComponentInfo* info;
+        void* data;
+    };
+
+    // info icin (gerekirse eski degeri yok ederek) construct edilmemis bellek dondurur
+    void* Allocate(const ComponentInfo* info);
+    void* Find(const ComponentInfo* info) const;
+
+    StringID m_Name;
+    std::vector<Entry> m_Components;
+    std::vector<const ComponentInfo*> m_Signature;
+    ComponentMask m_Mask;
+};
+
+} // namespace Archura
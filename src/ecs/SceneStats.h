@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Archetype.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Archura {
+
+/**
+ * @brief SceneFrameCounters - Bir frame'deki yapisal degisiklikler
+ *
+ * Scene, entity olusturma/silme ve archetype gecislerinde bu sayaclari
+ * arttirir; Scene::EndStatsFrame() ile frame kapatilir. Tip basina sayaclar
+ * ComponentTypeID ile indekslenir.
+ */
+struct SceneFrameCounters {
+    uint32_t entitiesCreated = 0;
+    uint32_t entitiesDestroyed = 0;
+    uint32_t archetypeMoves = 0;      // Add/RemoveComponent kaynakli satir tasimalari
+    uint32_t chunkAllocations = 0;
+    uint32_t chunkReleases = 0;
+    std::array<uint32_t, MAX_COMPONENTS> added{};    // Tip basina kazanilan satir
+    std::array<uint32_t, MAX_COMPONENTS> removed{};  // Tip basina kaybedilen satir
+
+    uint32_t GetStructuralChanges() const { return entitiesCreated + entitiesDestroyed + archetypeMoves; }
+};
+
+// Bir component tipinin tum archetype'lardaki toplam kullanimi
+struct ComponentTypeStats {
+    const ComponentInfo* info = nullptr;  // Hicbir archetype'ta yoksa nullptr
+    uint32_t count = 0;
+    size_t bytes = 0;          // count * size
+    size_t reservedBytes = 0;  // Ayrilmis chunk kapasitesi * size
+    uint32_t added = 0;        // Son frame
+    uint32_t removed = 0;
+};
+
+struct ArchetypeStats {
+    const Archetype* archetype = nullptr;
+    uint32_t entities = 0;
+    uint32_t capacity = 0;     // Ayrilmis chunk'lardaki satir sayisi
+    size_t chunks = 0;
+    size_t allocatedBytes = 0;
+    size_t usedBytes = 0;      // entities * satir boyutu
+};
+
+/**
+ * @brief SceneStats - Scene::GetStats() ciktisi (ECS bellek/doluluk profili)
+ *
+ * Vektorler tekrar kullanilir; her frame doldurmak ayirma yapmaz.
+ */
+struct SceneStats {
+    uint32_t entityCount = 0;
+    uint32_t archetypeCount = 0;       // Bos olmayan
+    uint32_t emptyArchetypeCount = 0;
+
+    size_t chunkBytes = 0;             // Ayrilmis tum archetype chunk'lari
+    size_t usedChunkBytes = 0;         // Canli satirlarin kapladigi kisim
+    size_t entityBytes = 0;            // Entity sayfalari + slot tablosu
+    size_t snapshotBytes = 0;          // Geri sarma gecmisi
+    size_t idleChunkBytes = 0;         // Chunk havuzunda bekleyen bos chunk'lar
+
+    SceneFrameCounters lastFrame;
+    std::vector<ComponentTypeStats> components;  // ComponentTypeID ile indeksli
+    std::vector<ArchetypeStats> archetypes;      // Bos olmayanlar
+
+    // Chunk'larda kullanilmayan oran (0 = tam dolu)
+    float GetFragmentation() const {
+        return chunkBytes ? 1.0f - static_cast<float>(usedChunkBytes) / static_cast<float>(chunkBytes) : 0.0f;
+    }
+
+    size_t GetTotalBytes() const { return chunkBytes + idleChunkBytes + entityBytes + snapshotBytes; }
+};
+
+} // namespace Archura
@@ -0,0 +1,299 @@
+#include "Snapshot.h"
+#include "Entity.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace Archura {
+
+namespace {
+
+uint32_t ChunkRows(uint32_t count, uint32_t capacity, size_t chunk) {
+    size_t first = chunk * capacity;
+    return first >= count ? 0 : static_cast<uint32_t>(std::min<size_t>(capacity, count - first));
+}
+
+} // namespace
+
+SnapshotRing::SnapshotRing(uint32_t capacity)
+    : m_Frames(std::max<uint32_t>(1, capacity))
+{
+}
+
+SnapshotRing::Segment* SnapshotRing::AllocateSegment() {
+    if (!m_FreeSegments) {
+        // Yeni sayfa: tum segmentler serbest listeye eklenir
+        m_Pages.push_back(std::make_unique<Segment[]>(SEGMENTS_PER_PAGE));
+        Segment* page = m_Pages.back().get();
+        for (size_t i = 0; i < SEGMENTS_PER_PAGE; ++i) {
+            page[i].next = m_FreeSegments;
+            m_FreeSegments = &page[i];
+        }
+    }
+
+    Segment* segment = m_FreeSegments;
+    m_FreeSegments = segment->next;
+    segment->refCount = 1;
+    ++m_LiveSegments;
+    return segment;
+}
+
+void SnapshotRing::ReleaseSegment(Segment* segment) {
+    if (--segment->refCount == 0) {
+        segment->next = m_FreeSegments;
+        m_FreeSegments = segment;
+        --m_LiveSegments;
+    }
+}
+
+void SnapshotRing::ReleaseTable(Segment* table) {
+    if (table->refCount > 1) {
+        --table->refCount;
+        return;
+    }
+
+    // Tablonun son sahibi: veri segmentleri de birakilir (bos kalan girisler nullptr)
+    Segment** entries = GetTableEntries(table);
+    for (size_t s = 0; s < MAX_SEGMENTS_PER_CHUNK && entries[s]; ++s) {
+        ReleaseSegment(entries[s]);
+    }
+    ReleaseSegment(table);
+}
+
+void SnapshotRing::ReleaseFrame(Frame& frame) {
+    for (Segment* table : frame.tables) {
+        ReleaseTable(table);
+    }
+    // clear() kapasiteyi korur: sonraki Capture tablo icin ayirma yapmaz
+    frame.archetypes.clear();
+    frame.streams.clear();
+    frame.tables.clear();
+    frame.number = 0;
+}
+
+void SnapshotRing::Clear() {
+    for (Frame& frame : m_Frames) {
+        ReleaseFrame(frame);
+    }
+    m_LatestFrame = 0;
+}
+
+size_t SnapshotRing::GetUsedBytes() const {
+    size_t bytes = m_LiveSegments * sizeof(Segment);
+    for (const Frame& frame : m_Frames) {
+        bytes += frame.archetypes.capacity() * sizeof(ArchetypeRecord)
+            + frame.streams.capacity() * sizeof(Stream)
+            + frame.tables.capacity() * sizeof(Segment*);
+    }
+    return bytes;
+}
+
+bool SnapshotRing::Contains(uint32_t frame) const {
+    return frame != 0 && frame <= m_LatestFrame
+        && m_Frames[frame % m_Frames.size()].number == frame;
+}
+
+void SnapshotRing::GatherEntityIDs(const Archetype& archetype, size_t chunk, uint32_t rows) {
+    m_LiveIDs.resize(archetype.GetChunkCapacity());
+    Entity** entities = archetype.GetEntities(chunk);
+    for (uint32_t row = 0; row < rows; ++row) {
+        m_LiveIDs[row] = entities[row]->GetID();
+    }
+}
+
+SnapshotRing::Segment* SnapshotRing::CaptureChunk(const std::byte* source, size_t length, Segment* previous, size_t previousLength) {
+    Segment* entries[MAX_SEGMENTS_PER_CHUNK] = {};
+    Segment* const* previousEntries = previous ? GetTableEntries(previous) : nullptr;
+    bool allShared = previous && previousLength == length;
+
+    size_t count = 0;
+    for (size_t offset = 0; offset < length; offset += SEGMENT_SIZE, ++count) {
+        size_t bytes = std::min(SEGMENT_SIZE, length - offset);
+
+        // Onceki frame'de ayni konumdaki segment ayni icerikteyse paylas
+        if (previous && offset < previousLength && std::min(SEGMENT_SIZE, previousLength - offset) == bytes) {
+            Segment* candidate = previousEntries[count];
+            if (std::memcmp(candidate->data, source + offset, bytes) == 0) {
+                ++candidate->refCount;
+                entries[count] = candidate;
+                continue;
+            }
+        }
+
+        allShared = false;
+        entries[count] = AllocateSegment();
+        std::memcpy(entries[count]->data, source + offset, bytes);
+    }
+
+    if (allShared) {
+        // Chunk hic degismedi: tablonun kendisi paylasilir (segment referanslari geri alinir)
+        for (size_t s = 0; s < count; ++s) {
+            --entries[s]->refCount;
+        }
+        ++previous->refCount;
+        return previous;
+    }
+
+    Segment* table = AllocateSegment();
+    std::memcpy(table->data, entries, sizeof(entries));
+    return table;
+}
+
+void SnapshotRing::ReadStream(const Frame& frame, const Stream& stream, size_t chunk, size_t offset, void* dst, size_t length) {
+    std::byte* out = static_cast<std::byte*>(dst);
+    Segment* const* entries = GetTableEntries(frame.tables[stream.firstTable + chunk]);
+    while (length > 0) {
+        // Eleman segment sinirina tasabilir
+        size_t s = offset / SEGMENT_SIZE;
+        size_t inSegment = offset % SEGMENT_SIZE;
+        size_t bytes = std::min(length, SEGMENT_SIZE - inSegment);
+        std::memcpy(out, entries[s]->data + inSegment, bytes);
+        out += bytes;
+        offset += bytes;
+        length -= bytes;
+    }
+}
+
+uint32_t SnapshotRing::Capture(Scene& scene) {
+    uint32_t number = m_LatestFrame + 1;
+    Frame& frame = m_Scratch;
+    frame.number = number;
+
+    const Frame* previous = Contains(m_LatestFrame) ? &m_Frames[m_LatestFrame % m_Frames.size()] : nullptr;
+    size_t previousRecord = 0;
+
+    const auto& archetypes = scene.GetArchetypes();
+    for (size_t index = 0; index < archetypes.size(); ++index) {
+        const Archetype& archetype = *archetypes[index];
+        uint32_t count = archetype.GetEntityCount();
+        if (count == 0) continue;
+
+        // Kayitlar archetype sirasinda: onceki frame'deki eslesi birlikte ilerleyerek bulunur
+        const ArchetypeRecord* previousArchetype = nullptr;
+        if (previous) {
+            while (previousRecord < previous->archetypes.size()
+                && previous->archetypes[previousRecord].archetypeIndex < index) {
+                ++previousRecord;
+            }
+            if (previousRecord < previous->archetypes.size()
+                && previous->archetypes[previousRecord].archetypeIndex == index) {
+                previousArchetype = &previous->archetypes[previousRecord];
+            }
+        }
+
+        ArchetypeRecord record{};
+        record.archetype = &archetype;
+        record.archetypeIndex = index;
+        record.count = count;
+        record.firstStream = static_cast<uint32_t>(frame.streams.size());
+
+        uint32_t capacity = archetype.GetChunkCapacity();
+        size_t chunkCount = archetype.GetChunkCount();
+
+        // Stream 0: satir entity ID'leri, ardindan trivially copyable kolonlar
+        auto addStream = [&](const ComponentInfo* info, int column, size_t elementSize) {
+            Stream stream{};
+            stream.info = info;
+            stream.column = column;
+            stream.elementSize = static_cast<uint32_t>(elementSize);
+            stream.firstTable = static_cast<uint32_t>(frame.tables.size());
+            frame.streams.push_back(stream);
+            frame.tables.resize(frame.tables.size() + chunkCount, nullptr);
+        };
+
+        addStream(nullptr, -1, sizeof(EntityID));
+        const auto& signature = archetype.GetSignature();
+        for (size_t col = 0; col < signature.size(); ++col) {
+            // Tek tabloya sigmayan dev kolonlar (CHUNK_SIZE'dan buyuk component) kaydedilmez
+            bool fits = size_t(capacity) * signature[col]->size <= MAX_SEGMENTS_PER_CHUNK * SEGMENT_SIZE;
+            if (signature[col]->trivial && fits) {
+                addStream(signature[col], static_cast<int>(col), signature[col]->size);
+            }
+        }
+        record.streamCount = static_cast<uint32_t>(frame.streams.size()) - record.firstStream;
+
+        for (uint32_t i = 0; i < record.streamCount; ++i) {
+            const Stream& stream = frame.streams[record.firstStream + i];
+            const Stream* previousStream = previousArchetype ? &previous->streams[previousArchetype->firstStream + i] : nullptr;
+
+            for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+                uint32_t rows = ChunkRows(count, capacity, chunk);
+                uint32_t previousRows = previousArchetype ? ChunkRows(previousArchetype->count, capacity, chunk) : 0;
+
+                const std::byte* source;
+                if (!stream.info) {
+                    GatherEntityIDs(archetype, chunk, rows);
+                    source = reinterpret_cast<const std::byte*>(m_LiveIDs.data());
+                } else {
+                    source = static_cast<const std::byte*>(archetype.GetColumnData(chunk, stream.column));
+                }
+
+                Segment* previousTable = previousRows ? previous->tables[previousStream->firstTable + chunk] : nullptr;
+                frame.tables[stream.firstTable + chunk] = CaptureChunk(source, size_t(rows) * stream.elementSize,
+                    previousTable, size_t(previousRows) * stream.elementSize);
+            }
+        }
+
+        frame.archetypes.push_back(record);
+    }
+
+    // En eski slotu birak ve yeni frame'i yerine koy (vektor kapasiteleri iki frame arasinda doner)
+    Frame& slot = m_Frames[number % m_Frames.size()];
+    ReleaseFrame(slot);
+    std::swap(slot, m_Scratch);
+    m_LatestFrame = number;
+    return number;
+}
+
+bool SnapshotRing::Restore(Scene& scene, uint32_t number) {
+    if (!Contains(number)) return false;
+
+    const Frame& frame = m_Frames[number % m_Frames.size()];
+    for (const ArchetypeRecord& record : frame.archetypes) {
+        const Archetype& archetype = *record.archetype;
+        uint32_t capacity = archetype.GetChunkCapacity();
+        const Stream& ids = frame.streams[record.firstStream];
+        size_t chunkCount = (record.count + capacity - 1) / capacity;
+
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+            uint32_t rows = ChunkRows(record.count, capacity, chunk);
+            m_SnapshotIDs.resize(capacity);
+            ReadStream(frame, ids, chunk, 0, m_SnapshotIDs.data(), rows * sizeof(EntityID));
+
+            // Hizli yol: chunk'ta ayni entity'ler ayni satirlardaysa kolonlar toplu kopyalanir
+            bool unchanged = archetype.GetChunkEntityCount(chunk) == rows;
+            if (unchanged) {
+                GatherEntityIDs(archetype, chunk, rows);
+                unchanged = std::memcmp(m_LiveIDs.data(), m_SnapshotIDs.data(), rows * sizeof(EntityID)) == 0;
+            }
+
+            for (uint32_t i = 1; i < record.streamCount; ++i) {
+                const Stream& stream = frame.streams[record.firstStream + i];
+
+                if (unchanged) {
+                    ReadStream(frame, stream, chunk, 0, archetype.GetColumnData(chunk, stream.column),
+                        size_t(rows) * stream.elementSize);
+                    continue;
+                }
+
+                // Yavas yol: entity'ler tasinmis/silinmis; her biri guncel konumuna yazilir
+                for (uint32_t row = 0; row < rows; ++row) {
+                    Entity* entity = scene.GetEntity(m_SnapshotIDs[row]);
+                    if (!entity) continue;
+
+                    int column = entity->m_Archetype->GetColumn(stream.info);
+                    if (column < 0) continue;
+
+                    ReadStream(frame, stream, chunk, size_t(row) * stream.elementSize,
+                        entity->m_Archetype->GetComponent(entity->m_Row, column), stream.elementSize);
+                }
+            }
+        }
+    }
+
+    // Parent degerleri de geri yazilmis olabilir: TransformSystem hiyerarsiyi yeniden kursun
+    ++scene.m_HierarchyVersion;
+    return true;
+}
+
+} // namespace Archura
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Archetype.h"
+#include "EntityID.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Archura {
+
+class Scene;
+
+/**
+ * @brief SnapshotRing - Component durumunun sabit kapasiteli frame gecmisi
+ *
+ * Capture() her archetype'in trivially copyable kolonlarini (Transform,
+ * RigidBody, Health, Projectile, ...) ve satir entity ID'lerini sabit boyutlu
+ * segmentlere kopyalar. Her segment onceki frame'in ayni segmentiyle
+ * karsilastirilir; degismeyenler kopyalanmaz, referans sayaciyla paylasilir
+ * (copy-on-write). Bir chunk kolonunun segment tablosu da ayni sekilde
+ * paylasilir: hic degismeyen chunk frame basina tek isaretci tutar.
+ *
+ * Segmentler sayfalardan ayrilir ve serbest listeyle tekrar kullanilir; halka
+ * doldugunda frame basina heap ayirma yapilmaz.
+ *
+ * Restore() sadece component degerlerini geri yazar: olusturma/silme gibi
+ * yapisal degisiklikler geri alinmaz. Snapshot'tan sonra silinen entity'ler
+ * atlanir, sonra olusanlara dokunulmaz. Pointer/string iceren component'ler
+ * (MeshRenderer, ScriptComponent, ...) kaydedilmez.
+ */
+class SnapshotRing {
+public:
+    static constexpr uint32_t DEFAULT_CAPACITY = 64;
+    static constexpr size_t SEGMENT_SIZE = 512;
+
+    explicit SnapshotRing(uint32_t capacity = DEFAULT_CAPACITY);
+    ~SnapshotRing() = default;
+
+    SnapshotRing(const SnapshotRing&) = delete;
+    SnapshotRing& operator=(const SnapshotRing&) = delete;
+
+    // Yeni frame kaydeder ve numarasini dondurur (1'den baslar); en eski frame silinir.
+    // Ana thread'den, iterasyon disinda cagrilmali.
+    uint32_t Capture(Scene& scene);
+
+    // Frame halkada yoksa false
+    bool Restore(Scene& scene, uint32_t frame);
+
+    bool Contains(uint32_t frame) const;
+    uint32_t GetLatestFrame() const { return m_LatestFrame; }  // Kayit yoksa 0
+    uint32_t GetCapacity() const { return static_cast<uint32_t>(m_Frames.size()); }
+
+    // Tum frame'leri birakir; segment sayfalari tekrar kullanim icin tutulur
+    void Clear();
+
+    // Bellek: ayrilan segment sayfalari; canli segmentler (paylasilanlar bir kez) + frame tablolari
+    size_t GetReservedBytes() const { return m_Pages.size() * SEGMENTS_PER_PAGE * sizeof(Segment); }
+    size_t GetUsedBytes() const;
+    size_t GetLiveSegmentCount() const { return m_LiveSegments; }
+
+private:
+    static constexpr size_t SEGMENTS_PER_PAGE = 128;
+
+    struct Segment {
+        Segment* next;       // Serbest liste
+        uint32_t refCount;   // Bu segmenti paylasan frame sayisi
+        alignas(16) std::byte data[SEGMENT_SIZE];
+    };
+
+    // Tablo segmenti: bir chunk kolonunun veri segmentlerine isaretciler
+    static constexpr size_t MAX_SEGMENTS_PER_CHUNK = SEGMENT_SIZE / sizeof(Segment*);
+
+    // Bir archetype kolonu (info != nullptr) veya satir entity ID'leri (info == nullptr)
+    struct Stream {
+        const ComponentInfo* info;
+        int column;
+        uint32_t elementSize;
+        uint32_t firstTable;  // Frame::tables indeksi; chunk c icin first + c
+    };
+
+    struct ArchetypeRecord {
+        const Archetype* archetype;
+        size_t archetypeIndex;  // Scene::GetArchetypes() sirasi (archetype'lar silinmez)
+        uint32_t count;
+        uint32_t firstStream;
+        uint32_t streamCount;
+    };
+
+    struct Frame {
+        uint32_t number = 0;
+        std::vector<ArchetypeRecord> archetypes;
+        std::vector<Stream> streams;
+        std::vector<Segment*> tables;
+    };
+
+    Segment* AllocateSegment();
+    void ReleaseSegment(Segment* segment);
+    void ReleaseTable(Segment* table);
+    void ReleaseFrame(Frame& frame);
+
+    static Segment** GetTableEntries(Segment* table) { return reinterpret_cast<Segment**>(table->data); }
+
+    // Chunk'in stream verisini (length byte) kaydeder ve tablosunu dondurur; onceki
+    // tablodaki (previousLength byte) esit segmentler, hepsi esitse tablonun kendisi paylasilir
+    Segment* CaptureChunk(const std::byte* source, size_t length, Segment* previous, size_t previousLength);
+
+    // Stream'in chunk'indaki [offset, offset + length) byte'larini dst'ye okur
+    static void ReadStream(const Frame& frame, const Stream& stream, size_t chunk, size_t offset, void* dst, size_t length);
+
+    void GatherEntityIDs(const Archetype& archetype, size_t chunk, uint32_t rows);
+
+    std::vector<Frame> m_Frames;
+    Frame m_Scratch;  // Yeni frame burada kurulur, sonra en eski slotla yer degistirir
+    uint32_t m_LatestFrame = 0;
+
+    std::vector<std::unique_ptr<Segment[]>> m_Pages;
+    Segment* m_FreeSegments = nullptr;
+    size_t m_LiveSegments = 0;
+
+    std::vector<EntityID> m_LiveIDs;      // Chunk'taki canli ID'ler
+    std::vector<EntityID> m_SnapshotIDs;  // Restore'da kayitli ID'ler
+};
+
+} // namespace Archura
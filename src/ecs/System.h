@@ -1,22 +1,93 @@
 #pragma once
 
+#include "Archetype.h"
+#include <vector>
+
 namespace Archura {
 
 class Scene;
 
 /**
  * @brief System base class - Game logic sistemleri buradan türer
+ *
+ * Sistemler hangi component'leri okuyup yazdigini constructor'da bildirir
+ * (Reads<...>() / Writes<...>()). SystemScheduler bu bilgiyle cakismayan
+ * sistemleri JobSystem worker'larinda ayni anda calistirir.
+ *
+ * Erisim bir kapsamla daraltilabilir: Writes<Transform>(With<Particle>{}),
+ * Transform'un sadece Particle'li entity'lerde yazildigini soyler. Sahnede iki
+ * erisimin kapsamina birden giren archetype yoksa (ornek: hem Particle hem
+ * RigidBody'li entity yok) ayni component'e dokunsalar da cakismazlar.
+ *
+ * Paralel calisan bir Update icinde yapisal degisiklikler (entity olusturma/
+ * silme, component ekleme/cikarma) Scene::GetCommandBuffer() ile yapilmalidir.
  */
 class System {
 public:
+    // Bildirilen bir erisim; scope bos ise tum entity'ler
+    struct Access {
+        ComponentMask components;
+        ComponentMask scope;
+        bool write;
+    };
+
     virtual ~System() = default;
 
     virtual void Init(Scene* scene) { m_Scene = scene; }
     virtual void Update(float deltaTime) = 0;
     virtual void Shutdown() {}
 
+    virtual const char* GetName() const { return "System"; }
+
+    const ComponentMask& GetReadMask() const { return m_ReadMask; }
+    const ComponentMask& GetWriteMask() const { return m_WriteMask; }
+    const std::vector<Access>& GetAccesses() const { return m_Accesses; }
+    Scene* GetScene() const { return m_Scene; }
+
+    // Kapsamsiz kontrol: biri digerinin okudugu/yazdigi bir component'i yaziyorsa.
+    // Kapsamlar sahneye bagli oldugu icin SystemScheduler ayrica archetype'lara bakar
+    bool ConflictsWith(const System& other) const {
+        return (m_WriteMask & (other.m_ReadMask | other.m_WriteMask)).any()
+            || (other.m_WriteMask & m_ReadMask).any();
+    }
+
 protected:
+    // Erisim kapsami: component'lerin hepsine sahip entity'ler
+    template<typename... Scope>
+    struct With {};
+
+    template<typename... Ts>
+    void Reads() { Declare<Ts...>(ComponentMask(), false); }
+
+    template<typename... Ts, typename... Scope>
+    void Reads(With<Scope...>) { Declare<Ts...>(MakeMask<Scope...>(), false); }
+
+    template<typename... Ts>
+    void Writes() { Declare<Ts...>(ComponentMask(), true); }
+
+    template<typename... Ts, typename... Scope>
+    void Writes(With<Scope...>) { Declare<Ts...>(MakeMask<Scope...>(), true); }
+
     Scene* m_Scene = nullptr;
+
+private:
+    template<typename... Ts>
+    static ComponentMask MakeMask() {
+        ComponentMask mask;
+        (mask.set(ComponentInfo::Get<Ts>()->id), ...);
+        return mask;
+    }
+
+    template<typename... Ts>
+    void Declare(const ComponentMask& scope, bool write) {
+        ComponentMask components = MakeMask<Ts...>();
+        (write ? m_WriteMask : m_ReadMask) |= components;
+        m_Accesses.push_back({ components, scope, write });
+    }
+
+    ComponentMask m_ReadMask;
+    ComponentMask m_WriteMask;
+    std::vector<Access> m_Accesses;
 };
 
 } // namespace Archura
@@ -0,0 +1,115 @@
+#include "SystemScheduler.h"
+#include "Entity.h"
+#include "System.h"
+#include "../core/threading/JobSystem.h"
+
+namespace Archura {
+
+void SystemScheduler::AddSystem(System* system) {
+    m_Systems.push_back(system);
+}
+
+void SystemScheduler::BuildGraph() {
+    if (m_NodeCount != m_Systems.size()) {
+        m_NodeCount = m_Systems.size();
+        m_Nodes = std::make_unique<Node[]>(m_NodeCount);
+    }
+
+    for (uint32_t i = 0; i < m_NodeCount; ++i) {
+        Node& node = m_Nodes[i];
+        node.system = m_Systems[i];
+        node.dependents.clear();
+        node.dependencyCount = 0;
+    }
+
+    // Kayit sirasi cakisan sistemler arasindaki sirayi belirler
+    for (uint32_t i = 0; i < m_NodeCount; ++i) {
+        for (uint32_t j = i + 1; j < m_NodeCount; ++j) {
+            if (Conflicts(*m_Nodes[i].system, *m_Nodes[j].system)) {
+                m_Nodes[i].dependents.push_back(j);
+                ++m_Nodes[j].dependencyCount;
+            }
+        }
+    }
+
+    // Sayaclar onceki frame'den sifirda kaldi
+    for (uint32_t i = 0; i < m_NodeCount; ++i) {
+        m_Nodes[i].pending.Add(m_Nodes[i].dependencyCount);
+    }
+}
+
+bool SystemScheduler::Conflicts(const System& a, const System& b) {
+    if (!a.ConflictsWith(b)) return false;
+
+    // Farkli/bilinmeyen sahne: kapsamlar karsilastirilamaz
+    const Scene* scene = a.GetScene();
+    if (!scene || scene != b.GetScene()) return true;
+
+    for (const System::Access& x : a.GetAccesses()) {
+        for (const System::Access& y : b.GetAccesses()) {
+            if (!x.write && !y.write) continue;
+
+            ComponentMask shared = x.components & y.components;
+            if (shared.none()) continue;
+            if (x.scope.none() && y.scope.none()) return true;
+
+            // Iki kapsama birden giren ve ortak component'i tasiyan bir archetype var mi.
+            // Paralel Update'te yapisal degisiklik olmadigi icin (CommandBuffer) frame boyunca gecerli
+            ComponentMask scope = x.scope | y.scope;
+            for (const auto& archetype : scene->GetArchetypes()) {
+                const ComponentMask& mask = archetype->GetMask();
+                if ((mask & scope) == scope && (mask & shared).any()) return true;
+            }
+        }
+    }
+    return false;
+}
+
+void SystemScheduler::Update(float deltaTime) {
+    if (m_Systems.empty()) return;
+
+    if (!m_Parallel || JobSystem::GetWorkerCount() == 0) {
+        for (System* system : m_Systems) {
+            system->Update(deltaTime);
+        }
+        return;
+    }
+
+    BuildGraph();
+
+    // Bagimli sistemler son onkosullari bitince kendiliginden kuyruga girer;
+    // kokler baslamadan kaydedilir ki hicbir sayac erken sifira inmesin
+    for (uint32_t i = 0; i < m_NodeCount; ++i) {
+        if (m_Nodes[i].dependencyCount == 0) continue;
+        JobSystem::ExecuteAfter(m_Nodes[i].pending, [this, i, deltaTime]() { RunNode(i, deltaTime); }, &m_FrameCounter);
+    }
+
+    // Kok sistemleri worker'lara ver, ilkini bu thread'de calistir
+    int inlineRoot = -1;
+    for (uint32_t i = 0; i < m_NodeCount; ++i) {
+        if (m_Nodes[i].dependencyCount != 0) continue;
+
+        if (inlineRoot < 0) {
+            inlineRoot = static_cast<int>(i);
+        } else {
+            JobSystem::Execute([this, i, deltaTime]() { RunNode(i, deltaTime); }, &m_FrameCounter);
+        }
+    }
+
+    // Beklerken bu thread de kuyruktaki job'lari calistirir
+    RunNode(static_cast<uint32_t>(inlineRoot), deltaTime);
+    JobSystem::Wait(m_FrameCounter);
+}
+
+void SystemScheduler::RunNode(uint32_t index, float deltaTime) {
+    Node& node = m_Nodes[index];
+    node.system->Update(deltaTime);
+
+    // Son onkosulu biten bagimli sistem kuyruga girer. Bagimli job zaten
+    // m_FrameCounter'da sayildigi icin Wait erken donmez.
+    for (uint32_t dependent : node.dependents) {
+        m_Nodes[dependent].pending.Decrement();
+    }
+}
+
+} // namespace Archura
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "../core/threading/JobSystem.h"
+#include <memory>
+#include <vector>
+
+namespace Archura {
+
+class System;
+
+/**
+ * @brief SystemScheduler - Sistemleri bildirilen component erisimine gore paralel calistirir
+ *
+ * Her frame sistemlerden bir bagimlilik grafi kurulur: kayit sirasinda once
+ * gelen ve cakisan her sistem sonrakinin onkosuludur. Cakisma bildirilen
+ * erisimlerden ve kapsamlarindan, sahnenin o anki archetype'larina gore bulunur
+ * (ayni component'e dokunan ama ortak entity'si olamayan sistemler cakismaz).
+ * Boylece cakisan sistemler eski seri sirayla, cakismayanlar JobSystem
+ * worker'larinda ayni anda calisir. Update tum sistemler bitince doner.
+ *
+ * Graf JobCounter'larla kurulur: her sistemin sayaci onkosul sayisiyla
+ * baslar, biten her onkosul bir dusurur; sifira inince sistem ExecuteAfter ile
+ * kuyruga girer. Update sadece bu frame'in job'larini bekler.
+ *
+ * JobSystem baslatilmamissa veya paralellik kapatildiysa kayit sirasiyla seri calisir.
+ */
+class SystemScheduler {
+public:
+    SystemScheduler() = default;
+    ~SystemScheduler() = default;
+
+    SystemScheduler(const SystemScheduler&) = delete;
+    SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+    // Sistemin sahipligi alinmaz
+    void AddSystem(System* system);
+    void Update(float deltaTime);
+
+    void SetParallel(bool parallel) { m_Parallel = parallel; }
+    bool IsParallel() const { return m_Parallel; }
+
+private:
+    struct Node {
+        System* system = nullptr;
+        std::vector<uint32_t> dependents;
+        uint32_t dependencyCount = 0;
+        JobCounter pending;  // Bu frame bitmemis onkosul sayisi
+    };
+
+    void BuildGraph();
+    // Kapsamlar dahil: sahnede iki sistemin birlikte eristigi bir entity olabilir mi
+    static bool Conflicts(const System& a, const System& b);
+    void RunNode(uint32_t index, float deltaTime);
+
+    std::vector<System*> m_Systems;
+    std::unique_ptr<Node[]> m_Nodes;  // JobCounter tasinamaz; boyut degisince yeniden ayrilir
+    size_t m_NodeCount = 0;
+    JobCounter m_FrameCounter;        // Bu Update'te kuyruga giren sistemler
+    bool m_Parallel = true;
+};
+
+} // namespace Archura
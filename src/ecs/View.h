@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Archetype.h"
+#include "../core/memory/FrameAllocator.h"
+#include "../core/threading/JobSystem.h"
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Archura {
+
+class Entity;
+
+/**
+ * @brief SceneView - Belirli component'lerin hepsine sahip entity'ler uzerinde sorgu
+ *
+ * Sadece eslesen archetype'lar gezilir; her chunk icinde component dizileri
+ * dogrusal okunur. Eslesen archetype listesi Scene tarafindan onbellekte tutulur;
+ * view olusturuldugu andaki listeyi tutar (sonradan olusan archetype'lar gezilmez),
+ * bu yuzden baska thread'de yeni archetype olusmasi gezinmeyi bozmaz.
+ *
+ * Kullanim:
+ *   scene.View<Transform, RigidBody>().Each([](Transform& t, RigidBody& rb) { ... });
+ *   scene.View<Particle>().Each([](Entity* e, Particle& p) { ... });
+ *
+ * Each sirasinda entity'e component eklemek/cikarmak veya entity silmek
+ * iterasyonu bozar; bu islemleri donguden sonra yapin.
+ *
+ * ParallelEach ayni sorguyu chunk'lara bolup JobSystem::ParallelFor ile
+ * worker'lara dagitir.
+ */
+template<typename... Ts>
+class SceneView {
+    static_assert(sizeof...(Ts) > 0, "SceneView en az bir component tipi gerektirir");
+
+public:
+    explicit SceneView(std::shared_ptr<const std::vector<Archetype*>> archetypes)
+        : m_Matches(std::move(archetypes)), m_Archetypes(*m_Matches) {}
+
+    template<typename Func>
+    void Each(Func&& func) const {
+        const ComponentInfo* infos[] = { ComponentInfo::Get<Ts>()... };
+        int columns[sizeof...(Ts)];
+
+        for (Archetype* archetype : m_Archetypes) {
+            if (archetype->GetEntityCount() == 0) continue;
+
+            for (size_t i = 0; i < sizeof...(Ts); ++i) {
+                columns[i] = archetype->GetColumn(infos[i]);
+            }
+
+            for (size_t chunk = 0; chunk < archetype->GetChunkCount(); ++chunk) {
+                EachInChunk(func, archetype, chunk, columns, std::index_sequence_for<Ts...>{});
+            }
+        }
+    }
+
+    /**
+     * @brief Each'in paralel hali; tum chunk'lar bitince doner
+     *
+     * func ayni anda birden fazla thread'den cagrilir: sadece verilen
+     * entity'nin component'lerine yazmali, yapisal degisiklikler
+     * CommandBuffer'a gitmeli. chunksPerJob 0 ise JobSystem secer.
+     */
+    template<typename Func>
+    void ParallelEach(Func&& func, uint32_t chunksPerJob = 0) const {
+        const ComponentInfo* infos[] = { ComponentInfo::Get<Ts>()... };
+
+        // Is birimi chunk (16 KiB ardisik veri): once tum eslesen chunk'lar toplanir
+        FrameVector<ChunkRef> chunks;
+        for (Archetype* archetype : m_Archetypes) {
+            if (archetype->GetEntityCount() == 0) continue;
+
+            ChunkRef ref;
+            ref.archetype = archetype;
+            for (size_t i = 0; i < sizeof...(Ts); ++i) {
+                ref.columns[i] = archetype->GetColumn(infos[i]);
+            }
+            for (size_t chunk = 0; chunk < archetype->GetChunkCount(); ++chunk) {
+                ref.chunk = chunk;
+                chunks.push_back(ref);
+            }
+        }
+
+        JobSystem::ParallelFor(0, static_cast<uint32_t>(chunks.size()), chunksPerJob, [&](const JobSystem::ParallelRange& range) {
+            for (uint32_t c = range.begin; c < range.end; ++c) {
+                EachInChunk(func, chunks[c].archetype, chunks[c].chunk, chunks[c].columns, std::index_sequence_for<Ts...>{});
+            }
+        });
+    }
+
+    // Eslesen entity sayisi
+    size_t Count() const {
+        size_t count = 0;
+        for (Archetype* archetype : m_Archetypes) {
+            count += archetype->GetEntityCount();
+        }
+        return count;
+    }
+
+private:
+    struct ChunkRef {
+        Archetype* archetype;
+        size_t chunk;
+        int columns[sizeof...(Ts)];
+    };
+
+    template<typename Func, size_t... I>
+    static void EachInChunk(Func& func, Archetype* archetype, size_t chunk, const int* columns, std::index_sequence<I...>) {
+        uint32_t count = archetype->GetChunkEntityCount(chunk);
+        Entity** entities = archetype->GetEntities(chunk);
+        std::tuple<Ts*...> arrays{ archetype->GetColumnData<Ts>(chunk, columns[I])... };
+
+        for (uint32_t i = 0; i < count; ++i) {
+            if constexpr (std::is_invocable_v<Func&, Entity*, Ts&...>) {
+                func(entities[i], std::get<I>(arrays)[i]...);
+            } else {
+                func(std::get<I>(arrays)[i]...);
+            }
+        }
+    }
+
+    std::shared_ptr<const std::vector<Archetype*>> m_Matches; // Listeyi canli tutar
+    const std::vector<Archetype*>& m_Archetypes;
+};
+
+} // namespace Archura
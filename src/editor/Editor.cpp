@@ -13,6 +13,8 @@
 #include <imgui.h>
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
+#include <algorithm>
+#include <cfloat>
 #include <iostream>
 #include "../core/DeveloperConsole.h"
 
@@ -78,6 +80,7 @@ void Editor::DrawEditorUI(Scene *scene) {
   if (m_ShowProjectPanel) DrawProjectPanel();
   if (m_ShowConsole) DrawConsolePanel();
   if (m_ShowPerformance) DrawPerformanceMetrics(ImGui::GetIO().DeltaTime, ImGui::GetIO().Framerate);
+  if (m_ShowECSStats) DrawECSStats(scene);
   if (m_ShowDemoWindow) DrawDemoWindow();
 }
 
@@ -182,6 +185,7 @@ void Editor::DrawMenuBar(Scene *scene) {
       ImGui::MenuItem("Console", nullptr, &m_ShowConsole);
       ImGui::Separator();
       ImGui::MenuItem("Performance Metrics", nullptr, &m_ShowPerformance);
+      ImGui::MenuItem("ECS Memory", nullptr, &m_ShowECSStats);
       ImGui::MenuItem("ImGui Demo Window", nullptr, &m_ShowDemoWindow);
       ImGui::EndMenu();
     }
@@ -438,8 +442,22 @@ void Editor::DrawSceneHierarchy(Scene *scene) {
 
   ImGui::Separator();
 
-  for (const auto &entityPtr : entities) {
-    Entity *entity = entityPtr.get();
+  // Isim filtresi: tam eslesme varsa Scene isim indeksinden (O(1)),
+  // yoksa alt metin aramasi
+  ImGui::InputTextWithHint("##HierarchyFilter", "Filter by name",
+                           m_HierarchyFilter, sizeof(m_HierarchyFilter));
+  std::string_view filter(m_HierarchyFilter);
+  const std::vector<Entity *> *visible = &entities;
+  if (!filter.empty()) {
+    const std::vector<Entity *> &named = scene->FindEntitiesByName(filter);
+    if (!named.empty())
+      visible = &named;
+  }
+
+  for (Entity *entity : *visible) {
+    if (visible == &entities && !filter.empty() &&
+        entity->GetName().find(filter) == std::string::npos)
+      continue;
 
     ImGuiTreeNodeFlags flags =
         ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
@@ -454,7 +472,7 @@ void Editor::DrawSceneHierarchy(Scene *scene) {
     }
 
     ImGui::TreeNodeEx(entity, flags, "%s (ID: %u)%s", entity->GetName().c_str(),
-                      entity->GetID(), isLookedAt ? " <--" : "");
+                      GetEntityIndex(entity->GetID()), isLookedAt ? " <--" : "");
 
     if (isLookedAt) {
       ImGui::PopStyleColor();
@@ -510,7 +528,8 @@ void Editor::DrawInspector(Scene *scene) {
     }
   }
 
-  ImGui::Text("ID: %u", m_SelectedEntity->GetID());
+  ImGui::Text("ID: %u (Gen: %u)", GetEntityIndex(m_SelectedEntity->GetID()),
+              GetEntityGeneration(m_SelectedEntity->GetID()));
   ImGui::Separator();
 
   // Donusum bileseni
@@ -691,6 +710,96 @@ void Editor::DrawPerformanceMetrics(float deltaTime, float fps) {
   ImGui::End();
 }
 
+void Editor::DrawECSStats(Scene *scene) {
+  ImGui::Begin("ECS Memory", &m_ShowECSStats);
+
+  static SceneStats stats;
+  scene->GetStats(stats);
+
+  ImGui::Text("Entities: %u  Archetypes: %u (%u empty)", stats.entityCount,
+              stats.archetypeCount, stats.emptyArchetypeCount);
+  ImGui::Text("Chunks: %.1f KB used / %.1f KB allocated (%.0f%% unused)",
+              stats.usedChunkBytes / 1024.0f, stats.chunkBytes / 1024.0f,
+              stats.GetFragmentation() * 100.0f);
+  ImGui::Text("Pooled idle chunks: %.1f KB", stats.idleChunkBytes / 1024.0f);
+  ImGui::Text("Entity records: %.1f KB  Snapshots: %.1f KB",
+              stats.entityBytes / 1024.0f, stats.snapshotBytes / 1024.0f);
+
+  // Frame basina yapisal degisiklik grafigi
+  const SceneFrameCounters &frame = stats.lastFrame;
+  static float changes[90] = {};
+  static int changeIdx = 0;
+  changes[changeIdx] = static_cast<float>(frame.GetStructuralChanges());
+  changeIdx = (changeIdx + 1) % 90;
+
+  ImGui::Separator();
+  ImGui::Text("Last frame: +%u / -%u entities, %u moves, chunks +%u / -%u",
+              frame.entitiesCreated, frame.entitiesDestroyed,
+              frame.archetypeMoves, frame.chunkAllocations, frame.chunkReleases);
+  ImGui::PlotHistogram("Structural Changes", changes, 90, changeIdx, nullptr,
+                       0.0f, FLT_MAX, ImVec2(0, 60));
+
+  // Component tipleri: en cok bellek kullanan once
+  ImGui::Separator();
+  static std::vector<const ComponentTypeStats *> sorted;
+  sorted.clear();
+  for (const ComponentTypeStats &type : stats.components) {
+    if (type.info)
+      sorted.push_back(&type);
+  }
+  std::sort(sorted.begin(), sorted.end(),
+            [](const ComponentTypeStats *a, const ComponentTypeStats *b) {
+              return a->reservedBytes > b->reservedBytes;
+            });
+
+  ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
+                          ImGuiTableFlags_SizingStretchProp;
+  if (ImGui::BeginTable("Components", 5, flags)) {
+    ImGui::TableSetupColumn("Component");
+    ImGui::TableSetupColumn("Count");
+    ImGui::TableSetupColumn("Used KB");
+    ImGui::TableSetupColumn("Reserved KB");
+    ImGui::TableSetupColumn("+/- frame");
+    ImGui::TableHeadersRow();
+
+    for (const ComponentTypeStats *type : sorted) {
+      ImGui::TableNextRow();
+      ImGui::TableNextColumn();
+      ImGui::TextUnformatted(type->info->name);
+      ImGui::TableNextColumn();
+      ImGui::Text("%u", type->count);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.1f", type->bytes / 1024.0f);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.1f", type->reservedBytes / 1024.0f);
+      ImGui::TableNextColumn();
+      ImGui::Text("+%u / -%u", type->added, type->removed);
+    }
+    ImGui::EndTable();
+  }
+
+  // Archetype doluluklari
+  if (ImGui::CollapsingHeader("Archetypes")) {
+    for (const ArchetypeStats &archetype : stats.archetypes) {
+      std::string name;
+      for (const ComponentInfo *info : archetype.archetype->GetSignature()) {
+        if (!name.empty())
+          name += " | ";
+        name += info->name;
+      }
+
+      float occupancy = archetype.capacity
+                            ? static_cast<float>(archetype.entities) /
+                                  static_cast<float>(archetype.capacity)
+                            : 0.0f;
+      ImGui::Text("%5u ent  %2zu chunks  %3.0f%%  %s", archetype.entities,
+                  archetype.chunks, occupancy * 100.0f, name.c_str());
+    }
+  }
+
+  ImGui::End();
+}
+
 void Editor::DrawDemoWindow() { ImGui::ShowDemoWindow(&m_ShowDemoWindow); }
 
 void Editor::DrawToolbar() {
@@ -792,13 +901,18 @@ void Editor::SpawnEntity(Scene *scene, const std::string &type,
   std::string name = type + "_" + std::to_string(++entityCounter);
 
   Entity *entity = scene->CreateEntity(name);
+  entity->AddComponent<MeshRenderer>();
+  entity->AddComponent<BoxCollider>();
+
+  // Component eklemek entity'i baska archetype'a tasir; isaretcileri
+  // tum eklemeler bittikten sonra al
   auto *transform = entity->GetComponent<Transform>();
   transform->position = m_SpawnPosition;
 
-  auto *meshRenderer = entity->AddComponent<MeshRenderer>();
+  auto *meshRenderer = entity->GetComponent<MeshRenderer>();
   meshRenderer->color = glm::vec3(1.0f); // White default
 
-  auto *collider = entity->AddComponent<BoxCollider>();
+  auto *collider = entity->GetComponent<BoxCollider>();
   collider->size = glm::vec3(1.0f);
 
   if (type == "Cube") {
@@ -830,7 +944,8 @@ void Editor::SpawnEntity(Scene *scene, const std::string &type,
     // MeshRenderer'i kaldir (otomatik eklendi yukarida)
     entity->RemoveComponent<MeshRenderer>();
     // Collider? Secmek icin ise yarar ama fiziksel etkilesim olmamali.
-    // Trigger yapalim.
+    // Trigger yapalim. (Ekleme/cikarma sonrasi isaretciyi yeniden al)
+    collider = entity->GetComponent<BoxCollider>();
     collider->isTrigger = true;
     collider->size = glm::vec3(0.5f);
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../ecs/EntityID.h"
 #include <filesystem>
 #include <glm/glm.hpp>
 #include <iostream>
@@ -61,8 +62,9 @@ public: // Members
 
   std::vector<std::string> m_ConsoleLogs;
   char m_InputBuf[256] = "";
-  uint32_t m_CachedEntityID =
-      0; // To track entity selection changes for renaming
+  char m_HierarchyFilter[128] = "";
+  EntityID m_CachedEntityID =
+      NullEntity; // To track entity selection changes for renaming
 
   // Project Browser
   std::filesystem::path m_BaseProjectDir;
@@ -79,6 +81,7 @@ private:
   void DrawProjectPanel();
   void DrawConsolePanel();
   void DrawPerformanceMetrics(float deltaTime, float fps);
+  void DrawECSStats(Scene *scene);
   void DrawDemoWindow();
   void DrawToolbar();
   void SpawnEntity(Scene *scene, const std::string &type,
@@ -94,6 +97,7 @@ private:
   bool m_ShowProjectPanel = true;
   bool m_ShowConsole = true;
   bool m_ShowPerformance = false;
+  bool m_ShowECSStats = false;
   bool m_ShowDemoWindow = false;
 };
 
@@ -21,6 +21,8 @@ struct AudioSource : public Component {
     // Runtime internal state
     std::string runtimeAlias;   // Internal MCI alias
     bool isPlaying = false;
+    int targetVolume = 0;       // Spatialized MCI volume (0 - 1000), computed each update
+    int appliedVolume = -1;     // Last volume sent to MCI, -1 = not sent yet
 };
 
 } // namespace Archura
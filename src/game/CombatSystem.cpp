@@ -0,0 +1,57 @@
+#include "CombatSystem.h"
+#include "GameEvents.h"
+#include "../ecs/Entity.h"
+#include "../ecs/Component.h"
+#include <algorithm>
+
+namespace Archura {
+
+CombatSystem::CombatSystem() {
+    Reads<Transform>();
+    Writes<Health>();
+}
+
+void CombatSystem::Update(float /*deltaTime*/) {
+    if (!m_Scene) return;
+
+    EventBus& events = m_Scene->GetEvents();
+
+    // 1. Isabetler: dogrudan hasar
+    events.ForEach<HitEvent>([&](const HitEvent& hit) {
+        DamageEvent damage;
+        damage.target = hit.target;
+        damage.source = hit.owner;
+        damage.amount = hit.damage;
+        events.Publish(damage);
+    });
+
+    // 2. Patlamalar: yaricap icindeki Health'lere mesafeyle azalan hasar
+    //    (atan hasar almaz; HitEvent'teki owner filtresiyle ayni)
+    events.ForEach<ExplosionEvent>([&](const ExplosionEvent& explosion) {
+        m_Scene->View<Health, Transform>().Each([&](Entity* entity, Health&, Transform& transform) {
+            if (entity->GetID() == explosion.owner) return;
+
+            float distance = glm::distance(transform.position, explosion.position);
+            if (distance > explosion.radius) return;
+
+            DamageEvent damage;
+            damage.target = entity->GetID();
+            damage.source = explosion.owner;
+            damage.amount = explosion.damage * (1.0f - distance / explosion.radius);
+            events.Publish(damage);
+        });
+    });
+
+    // 3. Tum hasarlar toplu uygulanir (silinmis hedefler atlanir)
+    events.ForEach<DamageEvent>([&](const DamageEvent& damage) {
+        Entity* target = m_Scene->GetEntity(damage.target);
+        if (!target) return;
+
+        if (auto* health = target->GetComponent<Health>()) {
+            health->current = std::max(0.0f, health->current - damage.amount);
+            health->isDead = health->current <= 0.0f;
+        }
+    });
+}
+
+} // namespace Archura
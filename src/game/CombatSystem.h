@@ -0,0 +1,25 @@
+#pragma once
+
+#include "../ecs/System.h"
+
+namespace Archura {
+
+class Scene;
+
+/**
+ * @brief CombatSystem - Hasar olaylarinin tuketicisi
+ *
+ * Frame'in HitEvent ve ExplosionEvent'lerini DamageEvent'e cevirir, ardindan
+ * tum DamageEvent'leri toplu olarak Health'e uygular. Ureticiler (mermi,
+ * patlama) bittikten sonra, tanimli bir noktada ana thread'de calisir.
+ * DamageEvent'ler frame sonuna kadar kalir; HUD vb. ayrica okuyabilir.
+ */
+class CombatSystem : public System {
+public:
+    CombatSystem();
+
+    void Update(float deltaTime) override;
+    const char* GetName() const override { return "CombatSystem"; }
+};
+
+} // namespace Archura
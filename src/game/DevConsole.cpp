@@ -31,7 +31,7 @@ void DevConsole::Init() {
 void DevConsole::Toggle() { m_IsOpen = !m_IsOpen; }
 
 void DevConsole::Log(const std::string &message) {
-  m_Logs.push_back(message);
+  m_Logs.emplace_back(message);
   m_ScrollToBottom = true;
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "../core/memory/MemoryResource.h"
+#include <memory_resource>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -30,7 +32,10 @@ namespace Archura {
         bool m_IsOpen = false;
         bool m_DevMode = false;
         char m_InputBuf[256] = "";
-        std::vector<std::string> m_Logs;
+
+        // Log satirlari boyut siniflarina gore havuzlanir (satir basina heap ayirmasi yok)
+        UnsynchronizedPoolResource m_LogMemory;
+        std::pmr::vector<std::pmr::string> m_Logs{ &m_LogMemory };
         bool m_ScrollToBottom = false;
 
         std::unordered_map<int, std::string> m_KeyBinds;
@@ -49,11 +49,9 @@ void FPSController::Update(Input* input, Scene* scene, float deltaTime, Projecti
 
     // --- ATIŞ MANTIĞI ---
     if (input->IsMouseButtonDown(GLFW_MOUSE_BUTTON_LEFT)) {
-        // Oyuncuyu Bul (Her kare verimsiz arama, ama demo için uygun)
-        Entity* player = nullptr;
-        for(auto& e : scene->GetEntities()) {
-            if(e->GetName() == "Player") { player = e.get(); break; }
-        }
+        // Oyuncuyu Bul (Scene isim indeksi: O(1))
+        static const StringID s_PlayerName("Player");
+        Entity* player = scene->FindEntityByName(s_PlayerName);
 
         if (player && projectileSystem) {
             auto* weapon = player->GetComponent<Weapon>();
@@ -320,107 +318,99 @@ bool FPSController::CheckCollision(const glm::vec3& position, Scene* scene, floa
     glm::vec3 feetPos = position;
     feetPos.y -= playerHeight;
 
-    // Sahnedeki tum varliklari kontrol et
-    for (auto& entity : scene->GetEntities()) {
-        auto* collider = entity->GetComponent<BoxCollider>();
-        auto* transform = entity->GetComponent<Transform>();
-        
-        if (collider && transform) {
-            if (collider->isTrigger) continue;
-
-            // Model Matrisini Olustur (T * R * S)
-            glm::mat4 model = glm::mat4(1.0f);
-            model = glm::translate(model, transform->position);
-            model = glm::rotate(model, glm::radians(transform->rotation.x), glm::vec3(1, 0, 0));
-            model = glm::rotate(model, glm::radians(transform->rotation.y), glm::vec3(0, 1, 0));
-            model = glm::rotate(model, glm::radians(transform->rotation.z), glm::vec3(0, 0, 1));
-            // Scale'i burada uygulamiyoruz, cunku BoxCollider size'i scale ile carpiyoruz
-            // VEYA: Scale'i matrise ekleyip, box size'i local (1,1,1) gibi dusunebiliriz.
-            // Mevcut yapida boxSize = collider->size * transform->scale yapiyorduk.
-            // OBB icin: Inverse Transform yaparken Scale'i de tersine cevirmek gerekir.
-            // Ancak Scale islemi AABB boyutunu degistirir, rotasyon ise eksenleri.
-            // En temizi: Rotasyon ve Pozisyonu matrise koyalim. Scale'i AABB boyutuna yedirelim.
+    // Sadece collider'a sahip varliklari kontrol et
+    bool anyHit = false;
+    scene->View<BoxCollider, Transform>().Each([&](BoxCollider& collider, Transform& transform) {
+        if (anyHit) return;
+        if (collider.isTrigger) return;
+
+        // Rotasyon ve pozisyon matrisi (T * R), render ile ayni rotasyon sirasi.
+        // Scale'i burada uygulamiyoruz, cunku BoxCollider size'i scale ile carpiyoruz
+        // VEYA: Scale'i matrise ekleyip, box size'i local (1,1,1) gibi dusunebiliriz.
+        // Mevcut yapida boxSize = collider.size * transform.scale yapiyorduk.
+        // OBB icin: Inverse Transform yaparken Scale'i de tersine cevirmek gerekir.
+        // Ancak Scale islemi AABB boyutunu degistirir, rotasyon ise eksenleri.
+        // En temizi: Rotasyon ve Pozisyonu matrise koyalim. Scale'i AABB boyutuna yedirelim.
+        // Statik duvarlar icin ikisi de Transform onbelleginden gelir (ters alma yok).
+        glm::mat4 model = transform.GetRigidMatrix();
+        glm::mat4 invModel = transform.GetInverseRigidMatrix();
+
+        // OBB kontrolü için yardımcı lambda
+        auto CheckOBB = [&](const glm::vec3& localCenter, const glm::vec3& localSize) -> bool {
+            // Kutu Boyutu (Scale dahil)
+            glm::vec3 boxHalfSize = localSize * transform.scale * 0.5f;
+            
+            glm::vec3 expandedMin = localCenter - boxHalfSize;
+            glm::vec3 expandedMax = localCenter + boxHalfSize;
+            
+            // Oyuncu Yaricapi (X ve Z)
+            expandedMin.x -= playerRadius; expandedMax.x += playerRadius;
+            expandedMin.z -= playerRadius; expandedMax.z += playerRadius;
+            
+            // Oyuncuyu tek bir nokta yerine, boyu boyunca birkac noktada test etmeliyiz.
+            // Boylece egik duvarlara kafa veya ayak carpmasini yakalayabiliriz.
+            // stepHeight: Bu yuksekligin altindaki engelleri yoksay (ayaklar girebilir)
             
-            glm::mat4 invModel = glm::inverse(model);
+            float checkStart = stepHeight - 0.1f; // Ayagin biraz altindan basla (Stabil zemin temasi icin)
+            float checkEnd = playerHeight - 0.1f; // Kafanin biraz altina kadar
+            
+            // 3 Nokta kontrolu: Alt, Orta, Ust
+            std::vector<float> checkHeights;
+            checkHeights.push_back(checkStart);
+            if (checkEnd > checkStart) {
+                checkHeights.push_back((checkStart + checkEnd) * 0.5f);
+                checkHeights.push_back(checkEnd);
+            }
 
-            // OBB kontrolü için yardımcı lambda
-            auto CheckOBB = [&](const glm::vec3& localCenter, const glm::vec3& localSize) -> bool {
-                // Kutu Boyutu (Scale dahil)
-                glm::vec3 boxHalfSize = localSize * transform->scale * 0.5f;
-                
-                glm::vec3 expandedMin = localCenter - boxHalfSize;
-                glm::vec3 expandedMax = localCenter + boxHalfSize;
-                
-                // Oyuncu Yaricapi (X ve Z)
-                expandedMin.x -= playerRadius; expandedMax.x += playerRadius;
-                expandedMin.z -= playerRadius; expandedMax.z += playerRadius;
-                
-                // Oyuncuyu tek bir nokta yerine, boyu boyunca birkac noktada test etmeliyiz.
-                // Boylece egik duvarlara kafa veya ayak carpmasini yakalayabiliriz.
-                // stepHeight: Bu yuksekligin altindaki engelleri yoksay (ayaklar girebilir)
+            for (float h : checkHeights) {
+                glm::vec4 testPos4 = invModel * glm::vec4(feetPos + glm::vec3(0, h, 0), 1.0f);
+                glm::vec3 testPos = glm::vec3(testPos4);
                 
-                float checkStart = stepHeight - 0.1f; // Ayagin biraz altindan basla (Stabil zemin temasi icin)
-                float checkEnd = playerHeight - 0.1f; // Kafanin biraz altina kadar
+                bool overlapX = testPos.x >= expandedMin.x && testPos.x <= expandedMax.x;
+                bool overlapY = testPos.y >= expandedMin.y && testPos.y <= expandedMax.y;
+                bool overlapZ = testPos.z >= expandedMin.z && testPos.z <= expandedMax.z;
                 
-                // 3 Nokta kontrolu: Alt, Orta, Ust
-                std::vector<float> checkHeights;
-                checkHeights.push_back(checkStart);
-                if (checkEnd > checkStart) {
-                    checkHeights.push_back((checkStart + checkEnd) * 0.5f);
-                    checkHeights.push_back(checkEnd);
-                }
-
-                for (float h : checkHeights) {
-                    glm::vec4 testPos4 = invModel * glm::vec4(feetPos + glm::vec3(0, h, 0), 1.0f);
-                    glm::vec3 testPos = glm::vec3(testPos4);
-                    
-                    bool overlapX = testPos.x >= expandedMin.x && testPos.x <= expandedMax.x;
-                    bool overlapY = testPos.y >= expandedMin.y && testPos.y <= expandedMax.y;
-                    bool overlapZ = testPos.z >= expandedMin.z && testPos.z <= expandedMax.z;
-                    
-                    if (overlapX && overlapY && overlapZ) {
-                        // Zemin tespiti (outGroundHeight) - Sadece en alt nokta icin mantikli olabilir
-                        // veya herhangi bir carpisma durumunda en yuksek noktayi bulmaya calisabiliriz.
-                        if (outGroundHeight) {
-                            float boxTopLocal = localCenter.y + boxHalfSize.y;
-                            // Eger oyuncu kutunun ustundeyse veya icindeyse (Tolerans artirildi: 0.1 -> 10.0)
-                            // Bu sayede hizli dususlerde (tunneling) zemin yuksekligi dogru algilanir.
-                            if (testPos.y >= boxTopLocal - 10.0f) { 
-                                glm::vec3 topPointLocal = testPos; 
-                                topPointLocal.y = boxTopLocal;
-                                glm::vec4 topPointWorld = model * glm::vec4(topPointLocal, 1.0f);
-                                
-                                if (topPointWorld.y > *outGroundHeight) {
-                                    *outGroundHeight = topPointWorld.y;
-                                }
+                if (overlapX && overlapY && overlapZ) {
+                    // Zemin tespiti (outGroundHeight) - Sadece en alt nokta icin mantikli olabilir
+                    // veya herhangi bir carpisma durumunda en yuksek noktayi bulmaya calisabiliriz.
+                    if (outGroundHeight) {
+                        float boxTopLocal = localCenter.y + boxHalfSize.y;
+                        // Eger oyuncu kutunun ustundeyse veya icindeyse (Tolerans artirildi: 0.1 -> 10.0)
+                        // Bu sayede hizli dususlerde (tunneling) zemin yuksekligi dogru algilanir.
+                        if (testPos.y >= boxTopLocal - 10.0f) { 
+                            glm::vec3 topPointLocal = testPos; 
+                            topPointLocal.y = boxTopLocal;
+                            glm::vec4 topPointWorld = model * glm::vec4(topPointLocal, 1.0f);
+                            
+                            if (topPointWorld.y > *outGroundHeight) {
+                                *outGroundHeight = topPointWorld.y;
                             }
                         }
-                        return true;
                     }
+                    return true;
                 }
-                return false;
-            };
-
-            bool hit = false;
-            
-            // Ana kutuyu kontrol et
-            if (glm::length(collider->size) > 0.01f) {
-                if (CheckOBB(collider->center, collider->size)) hit = true;
             }
+            return false;
+        };
 
-            // Alt kutuları kontrol et - KALDIRILDI (BoxCollider alt kutuları desteklemez)
-            /*
-            for (const auto& box : collider->subBoxes) {
-                if (CheckOBB(box.center, box.size)) hit = true;
-            }
-            */
+        bool hit = false;
+        
+        // Ana kutuyu kontrol et
+        if (glm::length(collider.size) > 0.01f) {
+            if (CheckOBB(collider.center, collider.size)) hit = true;
+        }
 
-            if (hit && !outGroundHeight) return true; 
-            if (hit && outGroundHeight) return true;
+        // Alt kutuları kontrol et - KALDIRILDI (BoxCollider alt kutuları desteklemez)
+        /*
+        for (const auto& box : collider.subBoxes) {
+            if (CheckOBB(box.center, box.size)) hit = true;
         }
-    }
+        */
+
+        if (hit) anyHit = true;
+    });
     
-    return false;
+    return anyHit;
 }
 
 void FPSController::HandleMouseLook(Input* input, float deltaTime) {
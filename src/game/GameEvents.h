@@ -0,0 +1,55 @@
+#pragma once
+
+#include "../ecs/EntityID.h"
+#include "SurfaceProperty.h"
+#include <glm/glm.hpp>
+
+namespace Archura {
+
+/**
+ * @brief Oyun olaylari - Scene::GetEvents() uzerinden yayinlanir
+ *
+ * Ureticiler (ProjectileSystem, PhysicsSystem) paralel calisirken sadece olay
+ * yayinlar; hasar ve efektler tuketicilerde (CombatSystem,
+ * ProjectileSystem::ProcessHitEvents) frame'in tanimli bir noktasinda toplu
+ * uygulanir. Olaylar frame sonunda silinir.
+ */
+
+// Mermi bir collider'a carpti
+struct HitEvent {
+    EntityID projectile = NullEntity;
+    EntityID target = NullEntity;
+    EntityID owner = NullEntity;
+    glm::vec3 position = glm::vec3(0.0f);
+    glm::vec3 normal = glm::vec3(0.0f, 1.0f, 0.0f);
+    float damage = 0.0f;
+    SurfaceType surface = SurfaceType::Concrete;
+};
+
+// Health'e uygulanacak (veya uygulanmis) hasar
+struct DamageEvent {
+    EntityID target = NullEntity;
+    EntityID source = NullEntity;
+    float amount = 0.0f;
+};
+
+// El bombasi patladi: yaricap icindeki Health'ler mesafeyle azalan hasar alir
+struct ExplosionEvent {
+    glm::vec3 position = glm::vec3(0.0f);
+    float radius = 0.0f;
+    float damage = 0.0f;
+    EntityID owner = NullEntity;
+};
+
+// Dinamik bir govde trigger collider'a girdi/cikti
+struct TriggerEnterEvent {
+    EntityID trigger = NullEntity;
+    EntityID other = NullEntity;
+};
+
+struct TriggerExitEvent {
+    EntityID trigger = NullEntity;
+    EntityID other = NullEntity;
+};
+
+} // namespace Archura
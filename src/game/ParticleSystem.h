@@ -7,12 +7,13 @@ namespace Archura {
 
 class ParticleSystem : public System {
 public:
-    ParticleSystem() = default;
+    ParticleSystem();
     ~ParticleSystem() = default;
 
     void Update(float deltaTime) override;
+    const char* GetName() const override { return "ParticleSystem"; }
     
-    // Helper to spawn a burst of particles
+    // Helper to spawn a burst of particles (ana thread; tek Instantiate)
     void EmitBurst(
         Scene* scene, 
         const glm::vec3& position, 
@@ -1,9 +1,16 @@
 #include "PhysicsSystem.h"
+#include "GameEvents.h"
 #include "../ecs/Entity.h"
+#include <algorithm>
 #include <iostream>
 
 namespace Archura {
 
+    PhysicsSystem::PhysicsSystem() {
+        Reads<BoxCollider, Transform>(With<BoxCollider>{});
+        Writes<RigidBody, Transform>(With<RigidBody>{});
+    }
+
     void PhysicsSystem::Init(Scene* scene) {
         m_Scene = scene;
         // std::cout << "Physics System Initialized (Internal Solver)" << std::endl;
@@ -14,6 +21,7 @@ namespace Archura {
 
         Integrate(deltaTime);
         ResolveCollisions();
+        PublishTriggerEvents();
     }
 
     void PhysicsSystem::Shutdown() {
@@ -21,70 +29,87 @@ namespace Archura {
     }
 
     void PhysicsSystem::Integrate(float deltaTime) {
-        for (auto& entityPtr : m_Scene->GetEntities()) {
-            Entity* entity = entityPtr.get();
-            auto* rb = entity->GetComponent<RigidBody>();
-            auto* transform = entity->GetComponent<Transform>();
-
-            if (rb && transform && !rb->isKinematic) {
-                // Yerçekimi Uygula
-                if (rb->useGravity) {
-                    rb->velocity += m_Gravity * deltaTime;
-                }
-
-                // Sürüklemeyi (Direnç) Uygula
-                rb->velocity *= (1.0f - rb->drag * deltaTime);
+        m_Scene->View<RigidBody, Transform>().Each([&](RigidBody& rb, Transform& transform) {
+            if (rb.isKinematic) return;
 
-                // Hızı Pozisyona Uygula
-                transform->position += rb->velocity * deltaTime;
+            // Yerçekimi Uygula
+            if (rb.useGravity) {
+                rb.velocity += m_Gravity * deltaTime;
             }
-        }
+
+            // Sürüklemeyi (Direnç) Uygula
+            rb.velocity *= (1.0f - rb.drag * deltaTime);
+
+            // Hızı Pozisyona Uygula
+            transform.position += rb.velocity * deltaTime;
+        });
     }
 
     void PhysicsSystem::ResolveCollisions() {
         // Çok temel O(N^2) AABB çarpışma çözümü
         // Gerçek bir motorda, uzaysal bölümleme (Octree/BVH) ve PhysX kullanın
-        
-        auto& entities = m_Scene->GetEntities();
-        for (size_t i = 0; i < entities.size(); ++i) {
-            Entity* entityA = entities[i].get();
-            auto* rbA = entityA->GetComponent<RigidBody>();
-            auto* colA = entityA->GetComponent<BoxCollider>();
-            auto* transA = entityA->GetComponent<Transform>();
-
-            if (!rbA || !colA || !transA || rbA->isKinematic) continue;
 
-            for (size_t j = 0; j < entities.size(); ++j) {
-                if (i == j) continue;
+        auto colliders = m_Scene->View<BoxCollider, Transform>();
 
-                Entity* entityB = entities[j].get();
-                auto* colB = entityB->GetComponent<BoxCollider>();
-                auto* transB = entityB->GetComponent<Transform>();
+        m_Scene->View<RigidBody, BoxCollider, Transform>().Each([&](Entity* entityA, RigidBody& rbA, BoxCollider& colA, Transform& transA) {
+            if (rbA.isKinematic) return;
 
-                // Statik nesnelerle (RB yok) veya dinamik nesnelerle (RB) çarpışıyoruz
-                if (!colB || !transB) continue;
+            // Statik nesnelerle (RB yok) veya dinamik nesnelerle (RB) çarpışıyoruz
+            colliders.Each([&](Entity* entityB, BoxCollider& colB, Transform& transB) {
+                if (entityA == entityB) return;
 
-                // Tetikleyicileri (Trigger) Kontrol Et
-                if (colA->isTrigger || colB->isTrigger) continue;
+                // Tetikleyiciler (Trigger) cozulmez, sadece ortusme kaydedilir
+                if (colA.isTrigger || colB.isTrigger) {
+                    if (CheckAABB(transA.position, colA.size * transA.scale, transB.position, colB.size * transB.scale)) {
+                        if (colB.isTrigger) m_TriggerOverlaps.emplace_back(entityB->GetID(), entityA->GetID());
+                        else m_TriggerOverlaps.emplace_back(entityA->GetID(), entityB->GetID());
+                    }
+                    return;
+                }
 
                 // AABB Kontrolü
-                if (CheckAABB(transA->position, colA->size * transA->scale, transB->position, colB->size * transB->scale)) {
+                if (CheckAABB(transA.position, colA.size * transA.scale, transB.position, colB.size * transB.scale)) {
                     // Çarpışma Tespit Edildi!
                     // Çok basit çözüm: Hızı durdur ve dışarı it (saf yöntem)
-                    
+
                     // Zemin olup olmadığını anlamak için Y eksenindeki örtüşmeyi belirle
-                    float yOverlap = (colA->size.y * transA->scale.y * 0.5f + colB->size.y * transB->scale.y * 0.5f) - std::abs(transA->position.y - transB->position.y);
-                    
+                    float yOverlap = (colA.size.y * transA.scale.y * 0.5f + colB.size.y * transB.scale.y * 0.5f) - std::abs(transA.position.y - transB.position.y);
+
                     if (yOverlap > 0) {
                         // Eğer düşüyorsak ve aşağıda bir şeye çarpıyorsak
-                        if (rbA->velocity.y < 0 && transA->position.y > transB->position.y) {
-                            transA->position.y += yOverlap;
-                            rbA->velocity.y = 0;
+                        if (rbA.velocity.y < 0 && transA.position.y > transB.position.y) {
+                            transA.position.y += yOverlap;
+                            rbA.velocity.y = 0;
                         }
                     }
                 }
+            });
+        });
+    }
+
+    void PhysicsSystem::PublishTriggerEvents() {
+        std::sort(m_TriggerOverlaps.begin(), m_TriggerOverlaps.end());
+        m_TriggerOverlaps.erase(std::unique(m_TriggerOverlaps.begin(), m_TriggerOverlaps.end()), m_TriggerOverlaps.end());
+
+        // Iki sirali listenin farki: yeni ortusmeler Enter, bitenler Exit
+        EventBus& events = m_Scene->GetEvents();
+        size_t i = 0, j = 0;
+        while (i < m_TriggerOverlaps.size() || j < m_PreviousTriggerOverlaps.size()) {
+            if (j == m_PreviousTriggerOverlaps.size()
+                || (i < m_TriggerOverlaps.size() && m_TriggerOverlaps[i] < m_PreviousTriggerOverlaps[j])) {
+                events.Publish(TriggerEnterEvent{ m_TriggerOverlaps[i].first, m_TriggerOverlaps[i].second });
+                ++i;
+            } else if (i == m_TriggerOverlaps.size() || m_PreviousTriggerOverlaps[j] < m_TriggerOverlaps[i]) {
+                events.Publish(TriggerExitEvent{ m_PreviousTriggerOverlaps[j].first, m_PreviousTriggerOverlaps[j].second });
+                ++j;
+            } else {
+                ++i;
+                ++j;
             }
         }
+
+        m_PreviousTriggerOverlaps.swap(m_TriggerOverlaps);
+        m_TriggerOverlaps.clear();
     }
 
     bool PhysicsSystem::CheckAABB(const glm::vec3& posA, const glm::vec3& sizeA, const glm::vec3& posB, const glm::vec3& sizeB) {
@@ -2,6 +2,7 @@
 
 #include "../ecs/Entity.h"
 #include "../ecs/Component.h"
+#include "../ecs/System.h"
 #include <vector>
 #include <glm/glm.hpp>
 
@@ -9,22 +10,31 @@ namespace Archura {
 
     class Scene;
 
-    class PhysicsSystem {
+    class PhysicsSystem : public System {
     public:
-        void Init(Scene* scene);
-        void Update(float deltaTime);
-        void Shutdown();
+        PhysicsSystem();
+
+        void Init(Scene* scene) override;
+        void Update(float deltaTime) override;
+        void Shutdown() override;
+
+        const char* GetName() const override { return "PhysicsSystem"; }
 
         // Raycast support (Basic AABB)
         bool Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, Entity** outEntity, glm::vec3* outHitPoint);
 
     private:
-        Scene* m_Scene = nullptr;
         glm::vec3 m_Gravity = glm::vec3(0.0f, -9.81f, 0.0f);
 
         void Integrate(float deltaTime);
         void ResolveCollisions();
         bool CheckAABB(const glm::vec3& posA, const glm::vec3& sizeA, const glm::vec3& posB, const glm::vec3& sizeB);
+
+        // Trigger ortusmeleri (trigger, diger) frame'ler arasi karsilastirilir: Enter/Exit olaylari
+        void PublishTriggerEvents();
+
+        std::vector<std::pair<EntityID, EntityID>> m_TriggerOverlaps;
+        std::vector<std::pair<EntityID, EntityID>> m_PreviousTriggerOverlaps;
     };
 
 } // namespace Archura
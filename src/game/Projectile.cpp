@@ -4,11 +4,13 @@
 #include "../ecs/Component.h"
 #include "../rendering/Mesh.h"
 #include "../core/ResourceManager.h"
+#include "GameEvents.h"
 #include "Lifetime.h"
 #include "SurfaceProperty.h"
 #include "Particle.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/constants.hpp>
+#include <cassert>
 #include <iostream>
 #include <random>
 #include <algorithm>
@@ -18,42 +20,39 @@ namespace Archura {
 void ProjectileSystem::Update(float deltaTime) {
     if (!m_Scene) return;
 
-    m_ProjectilesToDestroy.clear();
-    m_ProjectilesToDestroy.reserve(10); // Pre-allocate for common case
+    // Silme ve decal olusturma kaydedilir; Scene::FlushCommands ile frame sonunda uygulanir
+    CommandBuffer& commands = m_Scene->GetCommandBuffer();
+
+    // Collider AABB'leri bir kez toplanir; bu thread'in frame arenasinda (heap ayirmasi yok)
+    FrameVector<ColliderBounds> colliders;
+    if (m_Scene->View<Projectile>().Count() > 0) {
+        auto colliderView = m_Scene->View<BoxCollider, Transform>();
+        colliders.reserve(colliderView.Count());
+        colliderView.Each([&](Entity* entity, BoxCollider& collider, Transform& transform) {
+            glm::vec3 halfSize = collider.size * transform.scale * 0.5f;
+            colliders.push_back({ entity, transform.position, transform.position - halfSize, transform.position + halfSize });
+        });
+    }
 
     // Tum mermileri guncelle
-    for (auto& entityPtr : m_Scene->GetEntities()) {
-        auto* projectile = entityPtr->GetComponent<Projectile>();
-        if (projectile) {
-            UpdateProjectile(entityPtr.get(), projectile, deltaTime);
-            
-            // Diger varliklarla carpismayi kontrol et
-            if (CheckCollision(entityPtr.get(), m_Scene)) {
-                projectile->hasHit = true;
-                m_ProjectilesToDestroy.push_back(entityPtr.get());
-            }
+    m_Scene->View<Projectile>().Each([&](Entity* entity, Projectile& projectile) {
+        UpdateProjectile(entity, &projectile, deltaTime);
+
+        // Diger varliklarla carpismayi kontrol et
+        // (Ayni mermi hem suresi dolup hem carpabilir; ID ile silmek tekrarlari zararsiz kilar)
+        if (CheckCollision(entity, colliders)) {
+            projectile.hasHit = true;
+            commands.DestroyEntity(entity->GetID());
         }
-    }
-
-    // Vurmus veya suresi dolmus mermileri yok et
-    for (auto* entity : m_ProjectilesToDestroy) {
-        m_Scene->DestroyEntity(entity->GetID());
-    }
+    });
 
     // Generic Lifecycle System (Simple implementation here for now)
-    std::vector<Entity*> expiredEntities;
-    for (auto& entityPtr : m_Scene->GetEntities()) {
-        auto* lifetime = entityPtr->GetComponent<Lifetime>();
-        if (lifetime) {
-            lifetime->remainingTime -= deltaTime;
-            if (lifetime->remainingTime <= 0.0f) {
-                expiredEntities.push_back(entityPtr.get());
-            }
+    m_Scene->View<Lifetime>().Each([&](Entity* entity, Lifetime& lifetime) {
+        lifetime.remainingTime -= deltaTime;
+        if (lifetime.remainingTime <= 0.0f) {
+            commands.DestroyEntity(entity->GetID());
         }
-    }
-    for (auto* entity : expiredEntities) {
-        m_Scene->DestroyEntity(entity->GetID());
-    }
+    });
 }
 
 void ProjectileSystem::UpdateProjectile(Entity* entity, Projectile* proj, float deltaTime) {
@@ -63,7 +62,7 @@ void ProjectileSystem::UpdateProjectile(Entity* entity, Projectile* proj, float
     // Omur suresi kontrolu
     proj->lifetime -= deltaTime;
     if (proj->lifetime <= 0.0f) {
-        m_ProjectilesToDestroy.push_back(entity);
+        m_Scene->GetCommandBuffer().DestroyEntity(entity->GetID());
         return;
     }
 
@@ -71,11 +70,15 @@ void ProjectileSystem::UpdateProjectile(Entity* entity, Projectile* proj, float
     if (proj->type == Projectile::ProjectileType::Grenade) {
         proj->fuseTimer -= deltaTime;
         if (proj->fuseTimer <= 0.0f) {
-            // Patla!
-            // std::cout << "BOOM! Grenade exploded." << std::endl;
-            // Alan hasari mantigi burada (basitlestirilmis: sadece yok et)
-            // Gercek bir uygulamada, tum varliklara olan mesafeyi kontrol ederdik
-            m_ProjectilesToDestroy.push_back(entity);
+            // Patla! Alan hasari CombatSystem'de uygulanir
+            ExplosionEvent explosion;
+            explosion.position = transform->position;
+            explosion.radius = proj->explosionRadius;
+            explosion.damage = proj->damage;
+            explosion.owner = proj->owner;
+            m_Scene->GetEvents().Publish(explosion);
+
+            m_Scene->GetCommandBuffer().DestroyEntity(entity->GetID());
             return;
         }
     }
@@ -103,7 +106,7 @@ void ProjectileSystem::UpdateProjectile(Entity* entity, Projectile* proj, float
             }
         } else {
             // Mermiler zemine carpinca yok olur
-            m_ProjectilesToDestroy.push_back(entity);
+            m_Scene->GetCommandBuffer().DestroyEntity(entity->GetID());
             return;
         }
     }
@@ -111,7 +114,7 @@ void ProjectileSystem::UpdateProjectile(Entity* entity, Projectile* proj, float
     transform->position = nextPos;
 }
 
-bool ProjectileSystem::CheckCollision(Entity* projectile, Scene* scene) {
+bool ProjectileSystem::CheckCollision(Entity* projectile, const FrameVector<ColliderBounds>& colliders) {
     auto* proj = projectile->GetComponent<Projectile>();
     auto* projTransform = projectile->GetComponent<Transform>();
     
@@ -121,112 +124,111 @@ bool ProjectileSystem::CheckCollision(Entity* projectile, Scene* scene) {
     glm::vec3 projMin = projTransform->position - glm::vec3(0.1f);
     glm::vec3 projMax = projTransform->position + glm::vec3(0.1f);
 
-    bool hasHitAny = false;
+    // Ilk isabeti bul; hasar ve decal HitEvent tuketicilerinde uygulanir
+    Entity* hitTarget = nullptr;
+    glm::vec3 hitPos(0.0f);
+    glm::vec3 normal(0.0f);
+
+    for (const ColliderBounds& bounds : colliders) {
+        Entity* target = bounds.entity;
 
-    for (const auto& targetPtr : scene->GetEntities()) {
-        Entity* target = targetPtr.get();
-        
         // Kendine carpma
-        if (target == proj->owner) continue;
+        if (target->GetID() == proj->owner) continue;
         if (target == projectile) continue;
 
-        auto* collider = target->GetComponent<BoxCollider>();
-        auto* transform = target->GetComponent<Transform>();
-        auto* health = target->GetComponent<Health>();
-
-        if (collider && transform) {
-            // Hedef AABB
-            glm::vec3 halfSize = collider->size * transform->scale * 0.5f;
-            glm::vec3 targetMin = transform->position - halfSize;
-            glm::vec3 targetMax = transform->position + halfSize;
-
-            // AABB vs AABB Collision Detection
-            bool collisionX = projMax.x >= targetMin.x && projMin.x <= targetMax.x;
-            bool collisionY = projMax.y >= targetMin.y && projMin.y <= targetMax.y;
-            bool collisionZ = projMax.z >= targetMin.z && projMin.z <= targetMax.z;
-
-            if (collisionX && collisionY && collisionZ) {
-                
-                // Calculate Hit Normal (Axis of least penetration)
-                float overlapX = std::min(projMax.x, targetMax.x) - std::max(projMin.x, targetMin.x);
-                float overlapY = std::min(projMax.y, targetMax.y) - std::max(projMin.y, targetMin.y);
-                float overlapZ = std::min(projMax.z, targetMax.z) - std::max(projMin.z, targetMin.z);
-
-                glm::vec3 normal(0.0f);
-                glm::vec3 hitPos = projTransform->position;
-
-                if (overlapX < overlapY && overlapX < overlapZ) {
-                    normal = (projTransform->position.x > transform->position.x) ? glm::vec3(1, 0, 0) : glm::vec3(-1, 0, 0);
-                    hitPos.x = (normal.x > 0) ? targetMax.x : targetMin.x; // Snap to surface
-                } else if (overlapY < overlapX && overlapY < overlapZ) {
-                    normal = (projTransform->position.y > transform->position.y) ? glm::vec3(0, 1, 0) : glm::vec3(0, -1, 0);
-                    hitPos.y = (normal.y > 0) ? targetMax.y : targetMin.y;
-                } else {
-                    normal = (projTransform->position.z > transform->position.z) ? glm::vec3(0, 0, 1) : glm::vec3(0, 0, -1);
-                    hitPos.z = (normal.z > 0) ? targetMax.z : targetMin.z;
-                }
-
-                // Check Surface Property
-                SurfaceType surfaceType = SurfaceType::Concrete; // Default
-                if (auto* surfaceProp = target->GetComponent<SurfaceProperty>()) {
-                    surfaceType = surfaceProp->type;
-                }
-
-                // Spawn Decal with Surface Type
-                SpawnDecal(scene, hitPos, normal, surfaceType);
-
-                // Apply Damage if applicable
-                if (health) {
-                    health->current -= proj->damage;
-                    if (health->current < 0) health->current = 0;
-                }
-                
-                hasHitAny = true;
-                // std::cout << "Hit Entity " << target->GetName() << "! Damage: " << proj->damage << " Health: " << (health ? std::to_string(health->current) : "N/A") << std::endl;
-                
-                // Don't return strictly true immediately if we want to pierce, but for now destroy on first hit
-                return true;
+        // Hedef AABB
+        const glm::vec3& targetMin = bounds.min;
+        const glm::vec3& targetMax = bounds.max;
+
+        // AABB vs AABB Collision Detection
+        bool collisionX = projMax.x >= targetMin.x && projMin.x <= targetMax.x;
+        bool collisionY = projMax.y >= targetMin.y && projMin.y <= targetMax.y;
+        bool collisionZ = projMax.z >= targetMin.z && projMin.z <= targetMax.z;
+
+        if (collisionX && collisionY && collisionZ) {
+            
+            // Calculate Hit Normal (Axis of least penetration)
+            float overlapX = std::min(projMax.x, targetMax.x) - std::max(projMin.x, targetMin.x);
+            float overlapY = std::min(projMax.y, targetMax.y) - std::max(projMin.y, targetMin.y);
+            float overlapZ = std::min(projMax.z, targetMax.z) - std::max(projMin.z, targetMin.z);
+
+            hitPos = projTransform->position;
+
+            if (overlapX < overlapY && overlapX < overlapZ) {
+                normal = (projTransform->position.x > bounds.center.x) ? glm::vec3(1, 0, 0) : glm::vec3(-1, 0, 0);
+                hitPos.x = (normal.x > 0) ? targetMax.x : targetMin.x; // Snap to surface
+            } else if (overlapY < overlapX && overlapY < overlapZ) {
+                normal = (projTransform->position.y > bounds.center.y) ? glm::vec3(0, 1, 0) : glm::vec3(0, -1, 0);
+                hitPos.y = (normal.y > 0) ? targetMax.y : targetMin.y;
+            } else {
+                normal = (projTransform->position.z > bounds.center.z) ? glm::vec3(0, 0, 1) : glm::vec3(0, 0, -1);
+                hitPos.z = (normal.z > 0) ? targetMax.z : targetMin.z;
             }
+
+            // Don't stop strictly at the first hit if we want to pierce, but for now destroy on first hit
+            hitTarget = target;
+            break;
         }
     }
-    return false;
+
+    if (!hitTarget) return false;
+
+    HitEvent hit;
+    hit.projectile = projectile->GetID();
+    hit.target = hitTarget->GetID();
+    hit.owner = proj->owner;
+    hit.position = hitPos;
+    hit.normal = normal;
+    hit.damage = proj->damage;
+
+    // Check Surface Property
+    if (auto* surfaceProp = hitTarget->GetComponent<SurfaceProperty>()) {
+        hit.surface = surfaceProp->type;
+    }
+
+    m_Scene->GetEvents().Publish(hit);
+    return true;
+}
+
+void ProjectileSystem::ProcessHitEvents() {
+    if (!m_Scene) return;
+
+    // Isabetler toplu islenir; decal/parcacik entity'leri komut tamponuna kaydedilir
+    m_Scene->GetEvents().ForEach<HitEvent>([&](const HitEvent& hit) {
+        SpawnDecal(m_Scene, hit.position, hit.normal, hit.surface);
+    });
 }
 
 void ProjectileSystem::SpawnDecal(Scene* scene, const glm::vec3& position, const glm::vec3& normal, SurfaceType surfaceType) {
     if (!scene) return;
 
-    Entity* decal = scene->CreateEntity("Decal");
-    
-    // Add Lifetime
-    decal->AddComponent<Lifetime>(10.0f); // 10 seconds lifetime
+    // Iterasyon sirasinda da cagrilabilir: entity'ler ertelenmis olarak prefab'tan olusturulur
+    // (Lifetime, decal mesh ve 20cm olcek prefab'ta)
+    CommandBuffer& commands = scene->GetCommandBuffer();
 
     // Transform
-    auto* transform = decal->GetComponent<Transform>();
-    transform->position = position + normal * 0.02f; // Slight offset to prevent Z-fighting
-    transform->scale = glm::vec3(0.2f); // 20cm decal
+    Transform transform = *m_DecalPrefab.GetComponent<Transform>();
+    transform.position = position + normal * 0.02f; // Slight offset to prevent Z-fighting
 
     // Orientation logic (Align Quad +Y to Normal)
     // Simple axis aligned handling for Euler angles
     if (glm::abs(normal.y) > 0.9f) {
         // Ceiling or Floor
-        if (normal.y > 0) transform->rotation = glm::vec3(0.0f, 0.0f, 0.0f); // Up
-        else transform->rotation = glm::vec3(180.0f, 0.0f, 0.0f); // Down
+        if (normal.y > 0) transform.rotation = glm::vec3(0.0f, 0.0f, 0.0f); // Up
+        else transform.rotation = glm::vec3(180.0f, 0.0f, 0.0f); // Down
     } else if (glm::abs(normal.x) > 0.9f) {
         // Walls X
-        if (normal.x > 0) transform->rotation = glm::vec3(0.0f, 0.0f, -90.0f);
-        else transform->rotation = glm::vec3(0.0f, 0.0f, 90.0f); 
+        if (normal.x > 0) transform.rotation = glm::vec3(0.0f, 0.0f, -90.0f);
+        else transform.rotation = glm::vec3(0.0f, 0.0f, 90.0f); 
     } else {
         // Walls Z
-        if (normal.z > 0) transform->rotation = glm::vec3(90.0f, 0.0f, 0.0f);
-        else transform->rotation = glm::vec3(-90.0f, 0.0f, 0.0f);
+        if (normal.z > 0) transform.rotation = glm::vec3(90.0f, 0.0f, 0.0f);
+        else transform.rotation = glm::vec3(-90.0f, 0.0f, 0.0f);
     }
+    EntityID decal = commands.Instantiate(m_DecalPrefab, 1, &transform);
 
-    // Mesh Renderer
-    auto* meshRenderer = decal->AddComponent<MeshRenderer>();
-    
-    // Use Plane mesh
-    static Mesh* decalMesh = Mesh::CreatePlane(1.0f, 1.0f); // Static to avoid recreating
-    meshRenderer->mesh = decalMesh;
+    // Mesh Renderer (Plane mesh)
+    MeshRenderer meshRenderer = *m_DecalPrefab.GetComponent<MeshRenderer>();
 
     // Use Bullet Hole Texture if available, else black color
     // Color based on Surface Type
@@ -255,7 +257,8 @@ void ProjectileSystem::SpawnDecal(Scene* scene, const glm::vec3& position, const
     // Randomize slightly for variety (optional, keep simple for now)
     
     // Texture logic placeholder (eventually use different textures per material)
-    meshRenderer->color = decalColor;
+    meshRenderer.color = decalColor;
+    commands.AddComponent<MeshRenderer>(decal, meshRenderer);
 
     // --- Spawn Particles ---
     int particleCount = 5;
@@ -279,26 +282,31 @@ void ProjectileSystem::SpawnDecal(Scene* scene, const glm::vec3& position, const
     static std::mt19937 mt(std::random_device{}());
     std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
 
+    // Tum parcaciklar tek Instantiate ile; parcacik basina sadece Particle/renk yazilir
+    Transform particleTransforms[MAX_IMPACT_PARTICLES];
+    for (int i = 0; i < particleCount; ++i) {
+        particleTransforms[i].position = position + normal * 0.1f;
+        particleTransforms[i].scale = glm::vec3(particleSize);
+    }
+    EntityID firstParticle = commands.Instantiate(m_ImpactParticlePrefab, particleCount, particleTransforms);
+
     for(int i=0; i<particleCount; ++i) {
-        Entity* p = scene->CreateEntity("Particle");
-        auto* pt = p->AddComponent<Transform>();
-        pt->position = position + normal * 0.1f;
-        pt->scale = glm::vec3(particleSize);
+        EntityID p = firstParticle + i;
 
-        auto* par = p->AddComponent<Particle>();
-        par->color = glm::vec4(decalColor, 1.0f);
-        par->lifetime = 0.5f + (dist(mt) + 1.0f) * 0.2f;
-        par->startLifetime = par->lifetime;
+        Particle par;
+        par.color = glm::vec4(decalColor, 1.0f);
+        par.lifetime = 0.5f + (dist(mt) + 1.0f) * 0.2f;
+        par.startLifetime = par.lifetime;
 
         glm::vec3 rDir = glm::vec3(dist(mt), dist(mt), dist(mt));
         if(glm::dot(rDir, normal) < 0) rDir = -rDir;
-        par->velocity = glm::normalize(normal + rDir) * particleSpeed;
-        if(particleGravity) par->acceleration = glm::vec3(0.0f, -9.81f, 0.0f);
+        par.velocity = glm::normalize(normal + rDir) * particleSpeed;
+        if(particleGravity) par.acceleration = glm::vec3(0.0f, -9.81f, 0.0f);
+        commands.AddComponent<Particle>(p, par);
 
-        auto* pmr = p->AddComponent<MeshRenderer>();
-        static Mesh* cubeMesh = Mesh::CreateCube(1.0f); // Cube pixel
-        pmr->mesh = cubeMesh;
-        pmr->color = glm::vec3(decalColor);
+        MeshRenderer pmr = *m_ImpactParticlePrefab.GetComponent<MeshRenderer>();
+        pmr.color = glm::vec3(decalColor);
+        commands.AddComponent<MeshRenderer>(p, pmr);
     }
 }
 
@@ -313,27 +321,29 @@ Entity* ProjectileSystem::SpawnProjectile(
 ) {
     if (!scene) return nullptr;
 
-    // Mermi varligi olustur
+    // Mesh'ler Init'te olusturulur; burada GL cagrisi yapilmaz (worker'da calisabilir)
+    Mesh* projectileMesh = (type == Projectile::ProjectileType::Grenade) ? m_GrenadeMesh : m_BulletMesh;
+    assert(projectileMesh && "ProjectileSystem::Init must run before SpawnProjectile");
+    if (!projectileMesh) return nullptr;
+
+    // Mermi varligi olustur. Component'ler once eklenir: her AddComponent entity'yi baska
+    // bir archetype'a tasir ve daha once alinan component isaretcileri gecersizlesir
     Entity* projectile = scene->CreateEntity("Projectile");
-    
+    projectile->AddComponent<MeshRenderer>();
+    projectile->AddComponent<Projectile>();
+
     // Donusum
     auto* transform = projectile->GetComponent<Transform>();
     transform->position = position;
     
-    auto* meshRenderer = projectile->AddComponent<MeshRenderer>();
+    auto* meshRenderer = projectile->GetComponent<MeshRenderer>();
+    meshRenderer->mesh = projectileMesh; // Tek paylasilan mesh
     
     if (type == Projectile::ProjectileType::Grenade) {
-        meshRenderer->mesh = Mesh::CreateCube(1.0f); 
         meshRenderer->color = glm::vec3(0.0f, 0.5f, 0.0f); // Yesil El Bombasi
         transform->scale = glm::vec3(0.3f);
     } else {
         // Mermi
-        Mesh* bulletMesh = ResourceManager::Get().GetMesh("bullet");
-        if (!bulletMesh) {
-            bulletMesh = Mesh::CreateSphere(0.5f, 8);
-            ResourceManager::Get().AddMesh("bullet", bulletMesh);
-        }
-        meshRenderer->mesh = bulletMesh;
         meshRenderer->color = glm::vec3(1.0f, 1.0f, 0.0f); // Sari Mermi
         transform->scale = glm::vec3(0.1f, 0.1f, 0.3f);
     }
@@ -342,11 +352,11 @@ Entity* ProjectileSystem::SpawnProjectile(
     glm::vec3 normalizedDir = glm::normalize(direction);
     
     // Mermi bileseni
-    auto* proj = projectile->AddComponent<Projectile>();
+    auto* proj = projectile->GetComponent<Projectile>();
     proj->velocity = normalizedDir * speed;
     proj->speed = speed;
     proj->damage = damage;
-    proj->owner = owner;
+    proj->owner = owner ? owner->GetID() : NullEntity;
     proj->type = type;
     
     if (type == Projectile::ProjectileType::Grenade) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../ecs/Component.h"
+#include "../ecs/EntityID.h"
 #include <glm/glm.hpp>
 #include <glm/glm.hpp>
 #include <vector>
@@ -33,7 +34,7 @@ struct Projectile : public Component {
     float fuseTimer = 5.0f;
     float explosionRadius = 5.0f;
     
-    Entity* owner = nullptr;  // Projectile'i atan entity (self-hit onlemek icin)
+    EntityID owner = NullEntity;  // Projectile'i atan entity (self-hit onlemek icin); silinse bile guvenli
 };
 
 
@@ -2,15 +2,52 @@
 #include "../core/Application.h"
 #include "../ecs/Entity.h"
 #include "../ecs/Component.h"
+#include "../core/ResourceManager.h"
+#include "../rendering/Mesh.h"
+#include "Lifetime.h"
+#include "Particle.h"
+#include "SurfaceProperty.h"
 #include <iostream>
 
 namespace Archura {
 
-ProjectileSystem::ProjectileSystem() : m_Scene(nullptr) {
+ProjectileSystem::ProjectileSystem() {
+    // Hasar ve isabet efektleri olay olarak yayinlanir (HitEvent/ExplosionEvent); Health'e yazilmaz
+    Reads<BoxCollider, Transform, SurfaceProperty>(With<BoxCollider>{}); // Carpisma hedefleri
+    Writes<Projectile, Transform>(With<Projectile>{});
+    Writes<Lifetime>();
 }
 
 void ProjectileSystem::Init(Scene* scene) {
     m_Scene = scene;
+
+    // Mesh'lerin sahibi ResourceManager (kapanista silinir)
+    m_DecalMesh = ResourceManager::Get().GetMesh("decal");
+    if (!m_DecalMesh) {
+        m_DecalMesh = ResourceManager::Get().AddMesh("decal", Mesh::CreatePlane(1.0f, 1.0f));
+    }
+    m_ParticleMesh = ResourceManager::Get().GetMesh("particle_cube");
+    if (!m_ParticleMesh) {
+        m_ParticleMesh = ResourceManager::Get().AddMesh("particle_cube", Mesh::CreateCube(1.0f)); // Cube pixel
+    }
+
+    // Mermi mesh'leri burada (GL context'li ana thread) olusturulur: pipeline modunda
+    // simulasyon worker'da calisir, SpawnProjectile/EmitBurst GL cagrisi yapamaz
+    m_GrenadeMesh = ResourceManager::Get().GetMesh("grenade");
+    if (!m_GrenadeMesh) {
+        m_GrenadeMesh = ResourceManager::Get().AddMesh("grenade", Mesh::CreateCube(1.0f));
+    }
+    m_BulletMesh = ResourceManager::Get().GetMesh("bullet");
+    if (!m_BulletMesh) {
+        m_BulletMesh = ResourceManager::Get().AddMesh("bullet", Mesh::CreateSphere(0.5f, 8));
+    }
+
+    m_DecalPrefab.AddComponent<Lifetime>(10.0f); // 10 seconds lifetime
+    m_DecalPrefab.AddComponent<MeshRenderer>()->mesh = m_DecalMesh;
+    m_DecalPrefab.GetComponent<Transform>()->scale = glm::vec3(0.2f); // 20cm decal
+
+    m_ImpactParticlePrefab.AddComponent<Particle>();
+    m_ImpactParticlePrefab.AddComponent<MeshRenderer>()->mesh = m_ParticleMesh;
 }
 
 // Detailed implementations are in Projectile.cpp
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "../ecs/System.h"
+#include "../ecs/Entity.h"
+#include "../ecs/Prefab.h"
+#include "../core/memory/FrameAllocator.h"
 #include "Projectile.h"
 #include <vector>
 #include <memory>
@@ -16,19 +19,43 @@ public:
     ProjectileSystem();
     ~ProjectileSystem() = default;
 
-    void Init(Scene* scene);
+    void Init(Scene* scene) override;
     void Update(float deltaTime) override;
+    const char* GetName() const override { return "ProjectileSystem"; }
 
     void UpdateProjectile(Entity* entity, Projectile* proj, float deltaTime);
-    bool CheckCollision(Entity* projectile, Scene* scene);
+
+    // Carpisma adaylari: Update basinda bir kez toplanir (frame arenasi, mermi basina View gezilmez)
+    struct ColliderBounds {
+        Entity* entity;
+        glm::vec3 center;
+        glm::vec3 min;
+        glm::vec3 max;
+    };
+
+    // Ilk isabeti bulur ve HitEvent yayinlar (hasar/decal burada uygulanmaz)
+    bool CheckCollision(Entity* projectile, const FrameVector<ColliderBounds>& colliders);
     void SpawnDecal(Scene* scene, const glm::vec3& position, const glm::vec3& normal, SurfaceType surfaceType);
+
+    // HitEvent tuketicisi: frame'in isabetleri icin decal ve parcaciklar (sistemler bittikten sonra)
+    void ProcessHitEvents();
     
     Entity* SpawnProjectile(Scene* scene, const glm::vec3& position, const glm::vec3& direction, 
                             float speed, float damage, Entity* owner, Projectile::ProjectileType type);
 
 private:
-    Scene* m_Scene;
-    std::vector<Entity*> m_ProjectilesToDestroy;
+    // Bir isabette olusan en fazla parcacik (metal kivilcimlari)
+    static constexpr int MAX_IMPACT_PARTICLES = 10;
+
+    // GPU kaynaklari Init'te (ana thread) olusturulur; Update worker'da calisabilir
+    class Mesh* m_DecalMesh = nullptr;
+    class Mesh* m_ParticleMesh = nullptr;
+    class Mesh* m_GrenadeMesh = nullptr;
+    class Mesh* m_BulletMesh = nullptr;
+
+    // Isabet efektleri toplu olusturulur (Scene::Instantiate)
+    Prefab m_DecalPrefab{ "Decal" };
+    Prefab m_ImpactParticlePrefab{ "Particle" };
 };
 
 } // namespace Archura
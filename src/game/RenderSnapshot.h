@@ -0,0 +1,63 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Archura {
+
+class Mesh;
+class Shader;
+class Texture;
+
+/**
+ * @brief RenderSnapshot - Bir frame'in cizim verisinin degismez kopyasi
+ *
+ * RenderSystem::Capture simulasyon bittikten sonra sahneden doldurur;
+ * RenderSystem::Render sadece bunu okur, sahneye ve kameraya dokunmaz.
+ * Application iki tane tutar: ana thread birini cizerken siradaki frame'in
+ * simulasyonu digerini doldurur. Vektorler Clear'da kapasitesini korur,
+ * kararli durumda heap ayirmasi yapilmaz.
+ */
+struct RenderSnapshot {
+    // Ayni (mesh, shader, texture, renk) kombinasyonu: tek instanced cizim
+    struct Batch {
+        Mesh* mesh;
+        Shader* shader;
+        Texture* texture;
+        glm::vec3 color;
+        uint32_t firstInstance;  // instanceMatrices icindeki ilk matris
+        uint32_t instanceCount;
+    };
+
+    struct Light {
+        glm::vec3 position;
+        glm::vec3 direction; // Directional icin
+        glm::vec3 color;
+        float intensity;
+        float range;
+        int type; // 0 = Directional, 1 = Point
+    };
+
+    std::vector<Batch> batches;
+    std::vector<glm::mat4> instanceMatrices; // Batch'ler bitisik, batch sirasinda
+    std::vector<Light> lights;
+
+    // Kamera (Capture anindaki en-boy oraniyla)
+    glm::mat4 view = glm::mat4(1.0f);
+    glm::mat4 projection = glm::mat4(1.0f);
+    glm::vec3 cameraPosition = glm::vec3(0.0f);
+
+    uint32_t culledCount = 0;
+    bool valid = false; // En az bir kez Capture edildi
+
+    void Clear() {
+        batches.clear();
+        instanceMatrices.clear();
+        lights.clear();
+        culledCount = 0;
+        valid = false;
+    }
+};
+
+} // namespace Archura
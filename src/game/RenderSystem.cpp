@@ -1,16 +1,45 @@
 #include "RenderSystem.h"
 #include "../core/Engine.h"
 #include "../core/Window.h"
+#include "../core/memory/FrameAllocator.h"
 #include "../ecs/Entity.h"
 #include "../ecs/Component.h"
 #include "../rendering/Mesh.h"
 #include "../rendering/Texture.h"
 #include <glad/glad.h>
 #include <glm/gtc/matrix_transform.hpp>
+#include <array>
 #include <iostream>
+#include <string>
 
 namespace Archura {
 
+namespace {
+    // Shader siniri: uniform Light uLights[4]
+    constexpr size_t MAX_LIGHTS = 4;
+
+    // Uniform isimleri bir kez olusturulur; her frame std::string ayirmasin
+    struct LightUniformNames {
+        std::string position, color, intensity, range, type;
+    };
+
+    const LightUniformNames& GetLightUniformNames(size_t index) {
+        static const auto names = [] {
+            std::array<LightUniformNames, MAX_LIGHTS> result;
+            for (size_t i = 0; i < MAX_LIGHTS; ++i) {
+                std::string base = "uLights[" + std::to_string(i) + "]";
+                result[i] = { base + ".position", base + ".color", base + ".intensity", base + ".range", base + ".type" };
+            }
+            return result;
+        }();
+        return names[index];
+    }
+
+    // Kisa string optimizasyonuna sigmayan isimler (her cagri ayirma yapardi)
+    const std::string s_LightSpaceMatrixUniform = "uLightSpaceMatrix";
+    const std::string s_DepthLightSpaceMatrixUniform = "lightSpaceMatrix";
+}
+
 RenderSystem::RenderSystem(Camera* camera)
     : m_Camera(camera)
 {
@@ -67,141 +96,135 @@ void RenderSystem::InitShadowMap() {
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
-void RenderSystem::Update(float deltaTime) {
+void RenderSystem::Update(float /*deltaTime*/) {
     if (!m_Scene || !m_Camera) return;
 
-    // Reset State to defaults for normal rendering
-    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-    glEnable(GL_DEPTH_TEST);
-    glEnable(GL_CULL_FACE);
+    Capture(m_Snapshot, Engine::Get().GetWindow()->GetAspectRatio());
+    Render(m_Snapshot);
+}
+
+void RenderSystem::Capture(RenderSnapshot& snapshot, float aspectRatio) const {
+    snapshot.Clear();
+    if (!m_Scene || !m_Camera) return;
 
     // Kamera matrisleri
-    glm::mat4 view = m_Camera->GetViewMatrix();
-    Window* window = Engine::Get().GetWindow();
-    glm::mat4 projection = m_Camera->GetProjectionMatrix(window->GetAspectRatio());
+    snapshot.view = m_Camera->GetViewMatrix();
+    snapshot.projection = m_Camera->GetProjectionMatrix(aspectRatio);
+    snapshot.cameraPosition = m_Camera->GetPosition();
 
     // Batch Rendering Logic
     // Gruplandirma: Mesh -> (Texture/Shader) -> Transforms
-    // Simdilik Shader ve Texture tek tip varsayalim veya basitlestirelim.
-    // Map: Mesh* -> List of ModelMatrices
     // Isin dogrusu: Material yapisi olmali. Simdilik MeshRenderer icindeki mesh ve texture'a gore gruplayalim.
-    
-    struct RenderBatch {
-        Mesh* mesh;
-        Shader* shader;
-        Texture* texture;
-        glm::vec3 color; // Color override
-        std::vector<glm::mat4> instanceMatrices;
+
+    // Once her cizim batch indeksiyle frame arenasina toplanir, sonra batch'ler
+    // snapshot'ta bitisik olacak sekilde yerlestirilir
+    struct DrawItem {
+        uint32_t batch;
+        glm::mat4 model;
     };
-    
-    // Basit bir vector kullanalim, her unique (mesh, texture, shader) kombinasyonu icin bir batch
-    std::vector<RenderBatch> batches;
-    
-    // Cull edilenler
-    int culledCount = 0;
-    int renderedCount = 0;
-    
+    FrameVector<DrawItem> items;
+
     // 1. Collect
-    for (const auto& entityPtr : m_Scene->GetEntities()) {
-        auto* meshRenderer = entityPtr->GetComponent<MeshRenderer>();
-        auto* transform = entityPtr->GetComponent<Transform>();
-        
-        if (!meshRenderer || !transform || !meshRenderer->mesh) continue;
+    glm::vec3 camPos = snapshot.cameraPosition;
+
+    m_Scene->View<MeshRenderer, Transform>().Each([&](MeshRenderer& meshRenderer, Transform& transform) {
+        if (!meshRenderer.mesh) return;
 
         // Frustum Culling
-        glm::vec3 entityPos = transform->position;
-            glm::vec3 camPos = m_Camera->GetPosition();
-            float distance = glm::length(entityPos - camPos);
-            if (distance > 1000.0f) { // Uzakligi arttirdim
-                culledCount++;
-                continue;
+        float distance = glm::length(transform.position - camPos);
+        if (distance > 1000.0f) { // Uzakligi arttirdim
+            snapshot.culledCount++;
+            return;
         }
 
         // Batch bul veya olustur
-        Shader* targetShader = meshRenderer->shader ? meshRenderer->shader : m_DefaultShader.get();
-        Texture* targetTexture = meshRenderer->texture;
-        
-        bool found = false;
-        for (auto& batch : batches) {
-            if (batch.mesh == meshRenderer->mesh && 
-                batch.shader == targetShader && 
+        Shader* targetShader = meshRenderer.shader ? meshRenderer.shader : m_DefaultShader.get();
+        Texture* targetTexture = meshRenderer.texture;
+
+        uint32_t batchIndex = 0;
+        for (; batchIndex < snapshot.batches.size(); ++batchIndex) {
+            const RenderSnapshot::Batch& batch = snapshot.batches[batchIndex];
+            if (batch.mesh == meshRenderer.mesh &&
+                batch.shader == targetShader &&
                 batch.texture == targetTexture &&
-                batch.color == meshRenderer->color) { // Renk de ayni olmali
-                
-                batch.instanceMatrices.push_back(transform->GetModelMatrix());
-                found = true;
+                batch.color == meshRenderer.color) { // Renk de ayni olmali
                 break;
             }
         }
-        
-        if (!found) {
-            RenderBatch newBatch;
-            newBatch.mesh = meshRenderer->mesh;
-            newBatch.shader = targetShader;
-            newBatch.texture = targetTexture;
-            newBatch.color = meshRenderer->color;
-            newBatch.instanceMatrices.push_back(transform->GetModelMatrix());
-            batches.push_back(newBatch);
+
+        if (batchIndex == snapshot.batches.size()) {
+            snapshot.batches.push_back({ meshRenderer.mesh, targetShader, targetTexture, meshRenderer.color, 0, 0 });
         }
+
+        snapshot.batches[batchIndex].instanceCount++;
+        items.push_back({ batchIndex, transform.GetModelMatrix() });
+    });
+
+    // Batch baslangiclari, sonra matrisler yerine
+    uint32_t instanceOffset = 0;
+    for (RenderSnapshot::Batch& batch : snapshot.batches) {
+        batch.firstInstance = instanceOffset;
+        instanceOffset += batch.instanceCount;
+        batch.instanceCount = 0;
+    }
+
+    snapshot.instanceMatrices.resize(instanceOffset);
+    for (const DrawItem& item : items) {
+        RenderSnapshot::Batch& batch = snapshot.batches[item.batch];
+        snapshot.instanceMatrices[batch.firstInstance + batch.instanceCount++] = item.model;
     }
-    
 
     // Lighting Setup
     // Isiklari topla
-    struct LightData {
-        glm::vec3 position;
-        glm::vec3 direction; // For directional
-        glm::vec3 color;
-        float intensity;
-        float range;
-        int type; // 0 = Directional, 1 = Point
-    };
-
-    std::vector<LightData> lights;
-    
-    // Varsayilan isik (Gunes) eger hic isik yoksa
-    bool hasLights = false;
+    m_Scene->View<LightComponent, Transform>().Each([&](LightComponent& lightComp, Transform& transform) {
+        // Simdilik sadece ilk 4 isigi alalim (Shader siniri)
+        if (snapshot.lights.size() >= MAX_LIGHTS) return;
 
-    for (const auto& entityPtr : m_Scene->GetEntities()) {
-        auto* lightComp = entityPtr->GetComponent<LightComponent>();
-        auto* transform = entityPtr->GetComponent<Transform>();
+        RenderSnapshot::Light ld;
+        ld.position = transform.position; // Point light pos
         
-        if (lightComp && transform) {
-            LightData ld;
-            ld.position = transform->position; // Point light pos
-            
-            // Rotation'dan direction cikarimi (Directional light icin)
-            // Basitce Z ekseni rotasyonu varsayalim veya transform forward
-            // Simdilik (0, -1, 0) varsayip rotation ile cevirmemiz lazim ama 
-            // karmasiklastirmamak icin sadece position kullanalim.
-            // Directional light icin position = direction origin gibi dusunulebilir simdilik.
-            ld.direction = glm::vec3(-0.2f, -1.0f, -0.3f); // Sabit bir direction simdilik
-
-            ld.color = lightComp->color;
-            ld.intensity = lightComp->intensity;
-            ld.range = lightComp->range;
-            ld.type = (int)lightComp->type;
-            
-            lights.push_back(ld);
-            hasLights = true;
-            
-            // Simdilik sadece ilk 4 isigi alalim (Shader siniri)
-            if (lights.size() >= 4) break; 
-        }
-    }
+        // Rotation'dan direction cikarimi (Directional light icin)
+        // Basitce Z ekseni rotasyonu varsayalim veya transform forward
+        // Simdilik (0, -1, 0) varsayip rotation ile cevirmemiz lazim ama 
+        // karmasiklastirmamak icin sadece position kullanalim.
+        // Directional light icin position = direction origin gibi dusunulebilir simdilik.
+        ld.direction = glm::vec3(-0.2f, -1.0f, -0.3f); // Sabit bir direction simdilik
+
+        ld.color = lightComp.color;
+        ld.intensity = lightComp.intensity;
+        ld.range = lightComp.range;
+        ld.type = (int)lightComp.type;
+        
+        snapshot.lights.push_back(ld);
+    });
 
 
     // Eger hic isik yoksa varsayilan bir isik ekle
-    if (!hasLights) {
-        LightData defaultLight;
+    if (snapshot.lights.empty()) {
+        RenderSnapshot::Light defaultLight;
         defaultLight.position = glm::vec3(5.0f, 10.0f, 5.0f);
+        defaultLight.direction = glm::vec3(0.0f, -1.0f, 0.0f);
         defaultLight.color = glm::vec3(1.0f);
         defaultLight.intensity = 1.0f;
         defaultLight.range = 100.0f;
         defaultLight.type = 1; // Point
-        lights.push_back(defaultLight);
+        snapshot.lights.push_back(defaultLight);
     }
-    
+
+    snapshot.valid = true;
+}
+
+void RenderSystem::Render(const RenderSnapshot& snapshot) {
+    if (!snapshot.valid) return;
+
+    // Reset State to defaults for normal rendering
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_CULL_FACE);
+
+    Window* window = Engine::Get().GetWindow();
+    const auto& lights = snapshot.lights;
+
     // --- 1. Pass: Render to Shadow Map (Directional Light only) ---
     // En yakin directional isigi bul (Gunes)
     // Simdilik list'teki type=0 olan ilk isigi alalim
@@ -241,14 +264,12 @@ void RenderSystem::Update(float deltaTime) {
         m_LightSpaceMatrix = lightProjection * lightView;
         
         m_DepthShader->Bind();
-        m_DepthShader->SetMat4("lightSpaceMatrix", m_LightSpaceMatrix);
+        m_DepthShader->SetMat4(s_DepthLightSpaceMatrixUniform, m_LightSpaceMatrix);
         
         // Tum sahneyi depth icin render et
-        // Batch mantigini burada da kullanabiliriz ama basitlik icin direkt loop
-        // (Sadece MeshRenderer olanlari)
-        for (const auto& batch : batches) {
+        for (const auto& batch : snapshot.batches) {
              // Texture/Shader onemsiz, sadece geometry (model matrix)
-             batch.mesh->DrawInstanced(m_DepthShader.get(), batch.instanceMatrices);
+             batch.mesh->DrawInstanced(m_DepthShader.get(), snapshot.instanceMatrices.data() + batch.firstInstance, batch.instanceCount);
         }
         
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
@@ -265,18 +286,18 @@ void RenderSystem::Update(float deltaTime) {
     // Reset Viewport
     glViewport(0, 0, window->GetWidth(), window->GetHeight());
     
-    for (const auto& batch : batches) {
-        if (batch.instanceMatrices.empty()) continue;
+    for (const auto& batch : snapshot.batches) {
+        if (batch.instanceCount == 0) continue;
         
         Shader* shader = batch.shader;
         shader->Bind();
         
-        shader->SetMat4("uView", view);
-        shader->SetMat4("uProjection", projection);
-        shader->SetVec3("uViewPos", m_Camera->GetPosition());
+        shader->SetMat4("uView", snapshot.view);
+        shader->SetMat4("uProjection", snapshot.projection);
+        shader->SetVec3("uViewPos", snapshot.cameraPosition);
 
         // Shadow Map Uniforms
-        shader->SetMat4("uLightSpaceMatrix", m_LightSpaceMatrix);
+        shader->SetMat4(s_LightSpaceMatrixUniform, m_LightSpaceMatrix);
         shader->SetInt("uShadowMap", 1); // Texture Unit 1
         
         glActiveTexture(GL_TEXTURE1);
@@ -287,13 +308,13 @@ void RenderSystem::Update(float deltaTime) {
         shader->SetInt("uLightCount", (int)lights.size());
         
         for (size_t i = 0; i < lights.size(); i++) {
-            std::string base = "uLights[" + std::to_string(i) + "]";
-            shader->SetVec3(base + ".position", lights[i].position);
+            const LightUniformNames& names = GetLightUniformNames(i);
+            shader->SetVec3(names.position, lights[i].position);
             // shader->SetVec3(base + ".direction", lights[i].direction); // Future
-            shader->SetVec3(base + ".color", lights[i].color);
-            shader->SetFloat(base + ".intensity", lights[i].intensity);
-            shader->SetFloat(base + ".range", lights[i].range);
-            shader->SetInt(base + ".type", lights[i].type);
+            shader->SetVec3(names.color, lights[i].color);
+            shader->SetFloat(names.intensity, lights[i].intensity);
+            shader->SetFloat(names.range, lights[i].range);
+            shader->SetInt(names.type, lights[i].type);
         }
         
         // Material
@@ -308,16 +329,7 @@ void RenderSystem::Update(float deltaTime) {
         }
         
         // Tek seferde ciz (Instanced)
-        batch.mesh->DrawInstanced(shader, batch.instanceMatrices);
-        
-        renderedCount += batch.instanceMatrices.size();
-    }
-
-    // Hata ayiklama: her 60 karede bir culling istatistiklerini yazdir
-    static int frameCount = 0;
-    if (++frameCount >= 60) {
-        // std::cout << "Rendered: " << renderedCount << " | Culled: " << culledCount << std::endl;
-        frameCount = 0;
+        batch.mesh->DrawInstanced(shader, snapshot.instanceMatrices.data() + batch.firstInstance, batch.instanceCount);
     }
 }
 
@@ -352,25 +364,20 @@ void RenderSystem::DrawColliders() {
     m_DefaultShader->SetInt("uLightCount", 0); // No lights for debug wireframe
  
 
-    for (const auto& entityPtr : m_Scene->GetEntities()) {
-        auto* collider = entityPtr->GetComponent<BoxCollider>();
-        auto* transform = entityPtr->GetComponent<Transform>();
-        
-        if (!collider || !transform) continue;
-
+    m_Scene->View<BoxCollider, Transform>().Each([&](BoxCollider& collider, Transform& transform) {
         // Color based on isTrigger
-        glm::vec3 color = collider->isTrigger ? glm::vec3(1.0f, 1.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+        glm::vec3 color = collider.isTrigger ? glm::vec3(1.0f, 1.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
         m_DefaultShader->SetVec3("uDiffuse", color);
 
         // Calculate Transform: EntityModel * ColliderOffset * ColliderSize
-        glm::mat4 model = transform->GetModelMatrix();
-        model = glm::translate(model, collider->center);
-        model = glm::scale(model, collider->size);
+        glm::mat4 model = transform.GetModelMatrix();
+        model = glm::translate(model, collider.center);
+        model = glm::scale(model, collider.size);
         
         m_DefaultShader->SetMat4("uModel", model);
         
         m_DebugMesh->Draw(m_DefaultShader.get());
-    }
+    });
 
     // Restore state
     glPolygonMode(GL_FRONT, polygonMode[0]);
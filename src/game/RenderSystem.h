@@ -3,6 +3,7 @@
 #include "../ecs/System.h"
 #include "../rendering/Camera.h"
 #include "../rendering/Shader.h"
+#include "RenderSnapshot.h"
 #include <memory>
 
 namespace Archura {
@@ -16,9 +17,16 @@ public:
     ~RenderSystem() override;
 
     void Init(Scene* scene) override;
+    // Capture + Render ayni thread'de (sahneden dogrudan cizim)
     void Update(float deltaTime) override;
     void Shutdown() override;
 
+    // Sahne ve kameradan cizim verisini toplar; GL cagrisi yok, worker'da calisabilir.
+    // aspectRatio ana thread'de okunur (Window worker'dan sorgulanmaz)
+    void Capture(RenderSnapshot& snapshot, float aspectRatio) const;
+    // Sadece snapshot'i okur: ana thread (GL context), simulasyonla es zamanli olabilir
+    void Render(const RenderSnapshot& snapshot);
+
     void DrawColliders();
 
     void SetCamera(Camera* camera) { m_Camera = camera; }
@@ -28,6 +36,7 @@ private:
     Camera* m_Camera;
     std::unique_ptr<Shader> m_DefaultShader;
     class Mesh* m_DebugMesh = nullptr;
+    RenderSnapshot m_Snapshot; // Update() icin
     
     // Lighting
     // Lighting
@@ -4,6 +4,11 @@
 
 namespace Archura {
 
+    ScriptSystem::ScriptSystem() {
+        Reads<ScriptComponent>();
+        Writes<Transform>(With<ScriptComponent>{});
+    }
+
     void ScriptSystem::Init(Scene* scene) {
         m_Scene = scene;
         // std::cout << "Script System Initialized (Mock .NET Host)" << std::endl;
@@ -14,23 +19,15 @@ namespace Archura {
         if (!m_Scene) return;
 
         // Iterate over all entities with ScriptComponent
-        for (auto& entityPtr : m_Scene->GetEntities()) {
-            Entity* entity = entityPtr.get();
-            auto* script = entity->GetComponent<ScriptComponent>();
-
-            if (script) {
-                // Mock Execution: In real engine, we would call C# OnUpdate() here
-                // For now, we just log occasionally to prove the system is running
-                
-                // Example: If script name is "Rotator", rotate the entity
-                if (script->className == "Rotator") {
-                    auto* transform = entity->GetComponent<Transform>();
-                    if (transform) {
-                        transform->rotation.y += 90.0f * deltaTime;
-                    }
-                }
+        m_Scene->View<ScriptComponent, Transform>().Each([deltaTime](ScriptComponent& script, Transform& transform) {
+            // Mock Execution: In real engine, we would call C# OnUpdate() here
+            // For now, we just log occasionally to prove the system is running
+
+            // Example: If script name is "Rotator", rotate the entity
+            if (script.className == "Rotator") {
+                transform.rotation.y += 90.0f * deltaTime;
             }
-        }
+        });
     }
 
     void ScriptSystem::Shutdown() {
@@ -2,6 +2,7 @@
 
 #include "../ecs/Entity.h"
 #include "../ecs/Component.h"
+#include "../ecs/System.h"
 #include <string>
 #include <vector>
 
@@ -9,17 +10,19 @@ namespace Archura {
 
     class Scene;
 
-    class ScriptSystem {
+    class ScriptSystem : public System {
     public:
-        void Init(Scene* scene);
-        void Update(float deltaTime);
-        void Shutdown();
+        ScriptSystem();
+
+        void Init(Scene* scene) override;
+        void Update(float deltaTime) override;
+        void Shutdown() override;
+
+        const char* GetName() const override { return "ScriptSystem"; }
 
         void ReloadScripts();
 
     private:
-        Scene* m_Scene = nullptr;
-        
         // In a real implementation, this would hold the Mono Domain / Assembly
         // void* m_MonoDomain; 
     };
@@ -0,0 +1,223 @@
+#include "TransformSystem.h"
+#include "../ecs/Entity.h"
+#include "../core/threading/JobSystem.h"
+#include <algorithm>
+#include <unordered_map>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <xmmintrin.h>
+#define ARCHURA_TRANSFORM_SSE 1
+#endif
+
+namespace Archura {
+
+namespace {
+
+// Bu kadar dugumun altinda gruplari worker'lara dagitmak kazandirmaz
+constexpr size_t PARALLEL_NODE_THRESHOLD = 1024;
+constexpr size_t NODES_PER_JOB = 512;
+
+// out = a * b (kolon-major); SSE ile kolon basina 4 carpma-toplama
+inline void MultiplyMatrices(const glm::mat4& a, const glm::mat4& b, glm::mat4& out) {
+#ifdef ARCHURA_TRANSFORM_SSE
+    __m128 a0 = _mm_loadu_ps(&a[0][0]);
+    __m128 a1 = _mm_loadu_ps(&a[1][0]);
+    __m128 a2 = _mm_loadu_ps(&a[2][0]);
+    __m128 a3 = _mm_loadu_ps(&a[3][0]);
+
+    for (int col = 0; col < 4; ++col) {
+        __m128 result = _mm_mul_ps(a0, _mm_set1_ps(b[col][0]));
+        result = _mm_add_ps(result, _mm_mul_ps(a1, _mm_set1_ps(b[col][1])));
+        result = _mm_add_ps(result, _mm_mul_ps(a2, _mm_set1_ps(b[col][2])));
+        result = _mm_add_ps(result, _mm_mul_ps(a3, _mm_set1_ps(b[col][3])));
+        _mm_storeu_ps(&out[col][0], result);
+    }
+#else
+    out = a * b;
+#endif
+}
+
+} // namespace
+
+TransformSystem::TransformSystem() {
+    Writes<Transform>();
+    Reads<Parent>();
+}
+
+void TransformSystem::Update(float /*deltaTime*/) {
+    m_UpdatedCount = 0;
+    if (!m_Scene) return;
+
+    if (m_NeedsRebuild || m_HierarchyVersion != m_Scene->GetHierarchyVersion()) {
+        RebuildHierarchy();
+    }
+
+    // 1. Hiyerarsi: once kok alt agaclari (gruplarin koku dahil)
+    m_UpdatedCount += PropagateHierarchy();
+
+    // Gecis sirasinda silinmis dugum bulunduysa ayni frame'de yeniden kur
+    if (m_NeedsRebuild) {
+        RebuildHierarchy();
+        m_UpdatedCount += PropagateHierarchy();
+    }
+
+    // 2. Hiyerarsiye girmeyen tekil Transform'lar
+    m_Scene->View<Transform>().Each([this](Transform& transform) {
+        if (!transform.HasParent() && transform.UpdateMatrices()) {
+            ++m_UpdatedCount;
+        }
+    });
+}
+
+uint32_t TransformSystem::PropagateHierarchy() {
+    if (m_Groups.empty()) return 0;
+
+    uint32_t updated = 0;
+    if (m_Nodes.size() >= PARALLEL_NODE_THRESHOLD && m_Groups.size() > 1 && JobSystem::GetWorkerCount() > 0) {
+        // Alt agaclar birbirinden bagimsiz: gruplar worker'lara paylastirilir
+        std::atomic<uint32_t> parallelUpdated{0};
+        JobCounter counter;
+
+        for (size_t first = 0; first < m_Groups.size();) {
+            size_t last = first;
+            size_t nodeCount = 0;
+            while (last < m_Groups.size() && nodeCount < NODES_PER_JOB) {
+                nodeCount += m_Groups[last].end - m_Groups[last].begin;
+                ++last;
+            }
+
+            JobSystem::Execute([this, first, last, &parallelUpdated]() {
+                parallelUpdated += PropagateGroups(first, last);
+            }, &counter);
+            first = last;
+        }
+
+        // Sadece bu sistemin job'lari beklenir
+        JobSystem::Wait(counter);
+        updated = parallelUpdated;
+    } else {
+        updated = PropagateGroups(0, m_Groups.size());
+    }
+
+    m_ForceUpdate = false;
+    return updated;
+}
+
+uint32_t TransformSystem::PropagateGroups(size_t firstGroup, size_t lastGroup) {
+    uint32_t updated = 0;
+
+    for (size_t g = firstGroup; g < lastGroup; ++g) {
+        const Group& group = m_Groups[g];
+
+        // Parent her zaman child'dan once geldigi icin tek dogrusal gecis yeterli
+        for (uint32_t i = group.begin; i < group.end; ++i) {
+            Entity* entity = m_Scene->GetEntity(m_Nodes[i]);
+            if (!entity) {
+                // Silinmis dugum: alt agaci atla, sonraki frame'de yeniden kur
+                m_NeedsRebuild = true;
+                m_Dirty[i] = 0;
+                continue;
+            }
+
+            Transform* transform = entity->GetComponent<Transform>();
+            int32_t parent = m_ParentIndices[i];
+
+            bool changed;
+            if (parent < 0) {
+                changed = transform->UpdateMatrices() || m_ForceUpdate;
+                if (changed) {
+                    m_WorldMatrices[i] = transform->m_ModelMatrix;
+                }
+            } else {
+                // Parent bu geciste zaten islendi; m_Dirty[parent] guncel
+                changed = transform->UpdateLocalMatrix(m_LocalMatrices[i]) || m_ForceUpdate || m_Dirty[parent];
+                if (changed) {
+                    MultiplyMatrices(m_WorldMatrices[parent], m_LocalMatrices[i], m_WorldMatrices[i]);
+                    transform->SetWorldMatrix(m_WorldMatrices[i]);
+                }
+            }
+
+            m_Dirty[i] = changed ? 1 : 0;
+            if (changed) ++updated;
+        }
+    }
+
+    return updated;
+}
+
+void TransformSystem::RebuildHierarchy() {
+    m_HierarchyVersion = m_Scene->GetHierarchyVersion();
+    m_NeedsRebuild = false;
+
+    // Parent -> child listesi; parent'i silinmis child'lar da silinir
+    std::unordered_map<EntityID, std::vector<EntityID>> children;
+    std::vector<EntityID> roots;
+    std::vector<EntityID> orphans;
+
+    m_Scene->View<Parent, Transform>().Each([&](Entity* entity, Parent& parent, Transform& transform) {
+        transform.m_HasParent = true;
+        if (!m_Scene->IsValid(parent.entity)) {
+            orphans.push_back(entity->GetID());
+            return;
+        }
+
+        std::vector<EntityID>& siblings = children[parent.entity];
+        if (siblings.empty() && m_Scene->GetParent(parent.entity) == NullEntity) {
+            roots.push_back(parent.entity);
+        }
+        siblings.push_back(entity->GetID());
+    });
+
+    // Yetimlerin tum alt agaclari silinir (toplanan child listeleri uzerinden)
+    for (size_t i = 0; i < orphans.size(); ++i) {
+        auto it = children.find(orphans[i]);
+        if (it != children.end()) {
+            orphans.insert(orphans.end(), it->second.begin(), it->second.end());
+            children.erase(it);
+        }
+    }
+    for (EntityID orphan : orphans) {
+        m_Scene->DestroyEntity(orphan);
+    }
+
+    m_Nodes.clear();
+    m_ParentIndices.clear();
+    m_Groups.clear();
+
+    // Her kok icin genislik-oncelikli gezinti: parent'lar child'lardan once gelir
+    std::sort(roots.begin(), roots.end());
+    for (EntityID root : roots) {
+        Group group;
+        group.begin = static_cast<uint32_t>(m_Nodes.size());
+        m_Nodes.push_back(root);
+        m_ParentIndices.push_back(-1);
+
+        for (uint32_t i = group.begin; i < m_Nodes.size(); ++i) {
+            auto it = children.find(m_Nodes[i]);
+            if (it == children.end()) continue;
+
+            for (EntityID child : it->second) {
+                m_Nodes.push_back(child);
+                m_ParentIndices.push_back(static_cast<int32_t>(i));
+            }
+        }
+
+        group.end = static_cast<uint32_t>(m_Nodes.size());
+        m_Groups.push_back(group);
+    }
+
+    // Yeni kurulan dizide tum dunya matrisleri ilk gecisle doldurulur
+    m_LocalMatrices.resize(m_Nodes.size());
+    m_WorldMatrices.resize(m_Nodes.size());
+    m_Dirty.assign(m_Nodes.size(), 0);
+    m_ForceUpdate = true;
+
+    for (size_t i = 0; i < m_Nodes.size(); ++i) {
+        if (m_ParentIndices[i] >= 0) {
+            Entity* entity = m_Scene->GetEntity(m_Nodes[i]);
+            entity->GetComponent<Transform>()->MarkDirty();
+        }
+    }
+}
+
+} // namespace Archura
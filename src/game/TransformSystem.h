@@ -0,0 +1,58 @@
+#pragma once
+
+#include "../ecs/EntityID.h"
+#include "../ecs/System.h"
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace Archura {
+
+/**
+ * @brief TransformSystem - Kirli Transform'larin matris onbellegini yeniler
+ *
+ * Frame'de simulasyon ve FlushCommands'tan sonra, render'dan once calisir.
+ * Degismeyen Transform'lar icin sadece TRS karsilastirmasi yapilir.
+ *
+ * Hiyerarsi: Parent component'li entity'ler kok alt agaclarina gore gruplanir,
+ * her grup icinde parent-once-child (derinlik sirali) dizilir. Dunya matrisleri
+ * bu dizide tek dogrusal geciste, sadece kirli alt agaclar icin yayilir; buyuk
+ * hiyerarsilerde gruplar JobSystem worker'larina dagitilir.
+ */
+class TransformSystem : public System {
+public:
+    TransformSystem();
+
+    void Update(float deltaTime) override;
+    const char* GetName() const override { return "TransformSystem"; }
+
+    // Son Update'te yeniden hesaplanan matris sayisi
+    uint32_t GetUpdatedCount() const { return m_UpdatedCount; }
+
+private:
+    // Bir kok alt agacinin m_Nodes icindeki araligi
+    struct Group {
+        uint32_t begin;
+        uint32_t end;
+    };
+
+    void RebuildHierarchy();
+    uint32_t PropagateHierarchy();
+    uint32_t PropagateGroups(size_t firstGroup, size_t lastGroup);
+
+    // Dugum dizileri (SoA), parent-once-child sirasinda
+    std::vector<EntityID> m_Nodes;
+    std::vector<int32_t> m_ParentIndices;  // Grup koku icin -1
+    std::vector<glm::mat4> m_LocalMatrices;
+    std::vector<glm::mat4> m_WorldMatrices;
+    std::vector<uint8_t> m_Dirty;          // Bu geciste dunya matrisi degisti mi
+    bool m_ForceUpdate = false;            // Yeniden kurulumdan sonraki ilk gecis
+    std::vector<Group> m_Groups;
+
+    uint32_t m_HierarchyVersion = UINT32_MAX;
+    std::atomic<bool> m_NeedsRebuild{true};
+    uint32_t m_UpdatedCount = 0;
+};
+
+} // namespace Archura
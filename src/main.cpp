@@ -1,4 +1,5 @@
 #include "core/Application.h"
+#include "core/memory/MemoryTracker.h"
 #include "network/NetworkManager.h"
 #include <iostream>
 #include <cstdio>
@@ -28,5 +29,11 @@ int main(int argc, char** argv) {
 
     auto app = std::make_unique<Archura::Application>();
     app->Run();
+    app.reset();
+
+#if ARCH_MEMORY_TRACKING
+    // Kapanistan sonra hala canli olan izlenen ayirmalar (cagiri yeri ile)
+    Archura::MemoryTracker::ReportLeaks();
+#endif
     return 0;
 }
@@ -189,29 +189,39 @@ void NetworkManager::UpdateClient() {
     }
 }
 
-void NetworkManager::SendPlayerUpdate(const PlayerUpdatePacket& packet) {
-    if (!m_IsConnected) return;
+void NetworkManager::SendPacket(PacketType type, const void* payload, uint32_t size) {
+    size_t totalSize = sizeof(PacketHeader) + size;
+    if (totalSize > MAX_PACKET_SIZE) {
+        std::cerr << "Packet too large: " << totalSize << " bytes\n";
+        return;
+    }
 
-    std::vector<char> buffer;
     PacketHeader header;
-    header.type = PacketType::PlayerUpdate;
-    header.size = sizeof(PlayerUpdatePacket);
+    header.type = type;
+    header.size = size;
 
-    buffer.resize(sizeof(PacketHeader) + sizeof(PlayerUpdatePacket));
-    memcpy(buffer.data(), &header, sizeof(PacketHeader));
-    memcpy(buffer.data() + sizeof(PacketHeader), &packet, sizeof(PlayerUpdatePacket));
+    char* buffer = static_cast<char*>(m_SendBuffers.Allocate(MAX_PACKET_SIZE, alignof(PacketHeader)));
+    memcpy(buffer, &header, sizeof(PacketHeader));
+    memcpy(buffer + sizeof(PacketHeader), payload, size);
 
     if (m_IsServer) {
         // Server sends to all clients (except sender, but here we are the sender)
         // In this simple implementation, server player is also a client to itself logically
         // But for network, we send to all connected clients
         for (SOCKET client : m_ClientSockets) {
-            send(client, buffer.data(), (int)buffer.size(), 0);
+            send(client, buffer, (int)totalSize, 0);
         }
     } else {
         // Client sends to server
-        send(m_Socket, buffer.data(), (int)buffer.size(), 0);
+        send(m_Socket, buffer, (int)totalSize, 0);
     }
+
+    m_SendBuffers.Free(buffer);
+}
+
+void NetworkManager::SendPlayerUpdate(const PlayerUpdatePacket& packet) {
+    if (!m_IsConnected) return;
+    SendPacket(PacketType::PlayerUpdate, &packet, sizeof(PlayerUpdatePacket));
 }
 
 void NetworkManager::SetOnPlayerUpdate(std::function<void(const PlayerUpdatePacket&)> callback) {
@@ -220,23 +230,7 @@ void NetworkManager::SetOnPlayerUpdate(std::function<void(const PlayerUpdatePack
 
 void NetworkManager::SendPlayerShoot(const PlayerShootPacket& packet) {
     if (!m_IsConnected) return;
-
-    std::vector<char> buffer;
-    PacketHeader header;
-    header.type = PacketType::PlayerShoot;
-    header.size = sizeof(PlayerShootPacket);
-
-    buffer.resize(sizeof(PacketHeader) + sizeof(PlayerShootPacket));
-    memcpy(buffer.data(), &header, sizeof(PacketHeader));
-    memcpy(buffer.data() + sizeof(PacketHeader), &packet, sizeof(PlayerShootPacket));
-
-    if (m_IsServer) {
-        for (SOCKET client : m_ClientSockets) {
-            send(client, buffer.data(), (int)buffer.size(), 0);
-        }
-    } else {
-        send(m_Socket, buffer.data(), (int)buffer.size(), 0);
-    }
+    SendPacket(PacketType::PlayerShoot, &packet, sizeof(PlayerShootPacket));
 }
 
 void NetworkManager::SetOnPlayerShoot(std::function<void(const PlayerShootPacket&)> callback) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../core/memory/PoolAllocator.h"
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -79,6 +80,13 @@ private:
     NetworkManager() = default;
     ~NetworkManager() = default;
 
+    // Header + payload from a pooled send buffer, to the server or to every client
+    void SendPacket(PacketType type, const void* payload, uint32_t size);
+
+    // Matches the receive buffers in UpdateServer/UpdateClient
+    static constexpr size_t MAX_PACKET_SIZE = 1024;
+    PoolAllocator m_SendBuffers{ MAX_PACKET_SIZE, alignof(PacketHeader), MAX_PACKET_SIZE * 8, MemoryTag::Network };
+
     bool m_Initialized = false;
     bool m_IsServer = false;
     bool m_IsConnected = false;
@@ -14,13 +14,18 @@
 
 namespace Archura {
 
-Mesh::Mesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices)
+Mesh::Mesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, MemoryTag tag)
     : m_Vertices(vertices)
     , m_Indices(indices)
     , m_VAO(0)
     , m_VBO(0)
     , m_EBO(0)
 {
+    // Vector'ler silinince (operator delete) kayitlar kendiliginden duser
+    ARCH_TRACK_ALLOC(m_Vertices.data(), m_Vertices.capacity() * sizeof(Vertex), tag);
+    ARCH_TRACK_ALLOC(m_Indices.data(), m_Indices.capacity() * sizeof(unsigned int), tag);
+    (void)tag;
+
     SetupMesh();
 }
 
@@ -96,8 +101,8 @@ void Mesh::SetupInstancedAttributes() {
     m_InstancedSetup = true;
 }
 
-void Mesh::DrawInstanced(Shader* shader, const std::vector<glm::mat4>& models) {
-    if (models.empty()) return;
+void Mesh::DrawInstanced(Shader* shader, const glm::mat4* models, size_t count) {
+    if (count == 0) return;
 
     if (shader) {
         shader->Bind();
@@ -118,15 +123,15 @@ void Mesh::DrawInstanced(Shader* shader, const std::vector<glm::mat4>& models) {
 
     // Buffer verisini guncelle
     // Eger kapasite yeterliyse glBufferSubData, degilse glBufferData
-    size_t dataSize = models.size() * sizeof(glm::mat4);
+    size_t dataSize = count * sizeof(glm::mat4);
     if (dataSize > m_InstanceCapacity) {
-        glBufferData(GL_ARRAY_BUFFER, dataSize, models.data(), GL_DYNAMIC_DRAW);
+        glBufferData(GL_ARRAY_BUFFER, dataSize, models, GL_DYNAMIC_DRAW);
         m_InstanceCapacity = dataSize;
     } else {
-        glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, models.data());
+        glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, models);
     }
 
-    glDrawElementsInstanced(GL_TRIANGLES, static_cast<unsigned int>(m_Indices.size()), GL_UNSIGNED_INT, 0, static_cast<unsigned int>(models.size()));
+    glDrawElementsInstanced(GL_TRIANGLES, static_cast<unsigned int>(m_Indices.size()), GL_UNSIGNED_INT, 0, static_cast<unsigned int>(count));
     
     glBindVertexArray(0);
     
@@ -199,7 +204,7 @@ Mesh* Mesh::CreateCube(float size) {
         indices.push_back(base + 3);
     }
     
-    return new Mesh(vertices, indices);
+    return ARCH_NEW(MemoryTag::Rendering) Mesh(vertices, indices);
 }
 
 Mesh* Mesh::CreatePlane(float width, float height, float uvScale) {
@@ -218,7 +223,7 @@ Mesh* Mesh::CreatePlane(float width, float height, float uvScale) {
         0, 2, 3
     };
     
-    return new Mesh(vertices, indices);
+    return ARCH_NEW(MemoryTag::Rendering) Mesh(vertices, indices);
 }
 
 Mesh* Mesh::CreateSphere(float radius, int segments) {
@@ -265,7 +270,7 @@ Mesh* Mesh::CreateSphere(float radius, int segments) {
         }
     }
     
-    return new Mesh(vertices, indices);
+    return ARCH_NEW(MemoryTag::Rendering) Mesh(vertices, indices);
 }
 
 Mesh* Mesh::CreateCapsule(float radius, float height) {
@@ -415,7 +420,7 @@ Mesh* Mesh::CreateCapsule(float radius, float height) {
         }
     }
 
-    return new Mesh(vertices, indices);
+    return ARCH_NEW(MemoryTag::Rendering) Mesh(vertices, indices);
 }
 
 Mesh* Mesh::CreateStairs(float width, float height, float depth, int steps) {
@@ -501,7 +506,7 @@ Mesh* Mesh::CreateStairs(float width, float height, float depth, int steps) {
         vertexOffset += 24;
     }
 
-    return new Mesh(vertices, indices);
+    return ARCH_NEW(MemoryTag::Rendering) Mesh(vertices, indices);
 }
 
 Mesh* Mesh::CreateRamp(float width, float height, float depth) {
@@ -578,7 +583,7 @@ Mesh* Mesh::CreateRamp(float width, float height, float depth) {
     // Sol (Tri)
     indices.push_back(15); indices.push_back(16); indices.push_back(17);
 
-    return new Mesh(vertices, indices);
+    return ARCH_NEW(MemoryTag::Rendering) Mesh(vertices, indices);
 }
 
 Mesh* Mesh::LoadFromOBJ(const std::string& path) {
@@ -659,7 +664,7 @@ Mesh* Mesh::LoadFromOBJ(const std::string& path) {
     if (vertices.empty()) return nullptr;
     
     // std::cout << "Loaded OBJ: " << path << " (" << vertices.size() << " vertices)" << std::endl;
-    return new Mesh(vertices, indices);
+    return ARCH_NEW(MemoryTag::Assets) Mesh(vertices, indices, MemoryTag::Assets);
 }
 
 Mesh* Mesh::LoadFromFBX(const std::string& path) {
@@ -780,7 +785,7 @@ Mesh* Mesh::LoadFromFBX(const std::string& path) {
     }
 
     // std::cout << "Loaded FBX: " << path << " (" << vertices.size() << " vertices)" << std::endl;
-    return new Mesh(vertices, indices);
+    return ARCH_NEW(MemoryTag::Assets) Mesh(vertices, indices, MemoryTag::Assets);
 }
 
 
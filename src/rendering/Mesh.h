@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../core/memory/MemoryTracker.h"
 #include <vector>
 #include <string>
 #include <glm/glm.hpp>
@@ -38,7 +39,9 @@ struct Vertex {
  */
 class Mesh {
 public:
-    Mesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices);
+    // CPU tarafi vertex/index kopyalari MemoryTracker'da tag altinda sayilir
+    Mesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+         MemoryTag tag = MemoryTag::Rendering);
     ~Mesh();
 
     // Copy constructor ve assignment operator'ı disable et
@@ -46,7 +49,8 @@ public:
     Mesh& operator=(const Mesh&) = delete;
 
     void Draw(Shader* shader);
-    void DrawInstanced(Shader* shader, const std::vector<glm::mat4>& models);
+    void DrawInstanced(Shader* shader, const glm::mat4* models, size_t count);
+    void DrawInstanced(Shader* shader, const std::vector<glm::mat4>& models) { DrawInstanced(shader, models.data(), models.size()); }
 
     // Procedural mesh oluşturucular
     static Mesh* CreateCube(float size = 1.0f);